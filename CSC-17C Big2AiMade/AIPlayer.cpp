@@ -1,234 +1,187 @@
 #include "AIPlayer.h"
+#include "GameEngine.h"
+#include "HandEvaluator.h"
 #include <algorithm>
-#include <random>
-#include <ctime>
 
-AIPlayer::AIPlayer(const std::string& name, int diff) 
-    : Player(name), difficulty(diff) {
-    std::fill(patternCounts, patternCounts + 5, 0);
-    analyzeHand();
+AIPlayer::AIPlayer(const std::string& name, int diff)
+    : Player(name), difficulty(diff), rng(std::random_device{}()), endgameCards(diff == 1 ? 0 : 20) {
 }
 
 AIPlayer::~AIPlayer() {
     // Clean up is handled by base class
 }
 
-void AIPlayer::analyzeHand() {
-    cardPatterns.clear();
-    std::fill(patternCounts, patternCounts + 5, 0);
-    
-    // Group cards by value
-    std::map<int, std::array<Card*, 4>> valueGroups;
-    int groupCounts[14] = {0}; // Count cards of each value
-    
-    for (const auto& pair : hand) {
-        int value = pair.second->getValue();
-        valueGroups[value][groupCounts[value]++] = pair.second;
-    }
-    
-    // Find pairs
-    int pairCount = 0;
-    for (const auto& group : valueGroups) {
-        if (groupCounts[group.first] >= 2) {
-            cardPatterns["pair"][pairCount++] = group.second[0];
-            cardPatterns["pair"][pairCount++] = group.second[1];
-            patternCounts[0] = pairCount;
-        }
+void AIPlayer::newGame(int seat, std::uint64_t seed) {
+    rng.seed(static_cast<std::uint32_t>(seed ^ (seed >> 32)) + static_cast<std::uint32_t>(seat));
+}
+
+Move AIPlayer::chooseMove(const GameEngine& engine, const MoveList& legal) {
+    Move choice;
+    if (solveEndgame(engine, legal, choice)) {
+        return choice;
     }
-    
-    // Find three of a kind
-    int threeCount = 0;
-    for (const auto& group : valueGroups) {
-        if (groupCounts[group.first] >= 3) {
-            cardPatterns["three"][threeCount++] = group.second[0];
-            cardPatterns["three"][threeCount++] = group.second[1];
-            cardPatterns["three"][threeCount++] = group.second[2];
-            patternCounts[1] = threeCount;
+    return decide(engine.getHand(engine.getCurrentPlayer()), engine.getTrick(), legal);
+}
+
+bool AIPlayer::solveEndgame(const GameEngine& engine, const MoveList& legal, Move& choice) {
+    int cardsLeft = 0;
+    for (int player = 0; player < GameEngine::NUM_PLAYERS; player++) {
+        cardsLeft += engine.getCardsLeft(player);
+    }
+    if (endgameCards <= 0 || cardsLeft > endgameCards || legal.count == 1) {
+        return false;
+    }
+    if (!solver) {
+        solver.reset(new EndgameSolver());
+    }
+
+    // Only the played cards and hand sizes are known; the rest is dealt uniformly
+    BeliefModel belief;
+    belief.reset(engine, engine.getCurrentPlayer());
+    std::uint64_t randomState = (static_cast<std::uint64_t>(rng()) << 32) | rng();
+    std::vector<int> wins;
+    solver->countWins(engine, belief, legal, ENDGAME_SAMPLES, randomState, wins);
+
+    int best = 0;
+    for (int i = 1; i < legal.count; i++) {
+        if (wins[i] > wins[best]) {
+            best = i;
         }
     }
-    
-    // Find potential straights
-    std::array<Card*, 13> sortedCards;
-    int cardCount = 0;
+    if (wins[best] == 0) {
+        return false;
+    }
+    choice = legal[best];
+    return true;
+}
+
+std::array<Card*, 5> AIPlayer::toCards(const Move& move) const {
+    std::array<Card*, 5> play;
+    std::fill(play.begin(), play.end(), nullptr);
+
+    // Return the cards lowest first
+    std::array<Card*, NUM_CARDS> byIndex;
     for (const auto& pair : hand) {
-        sortedCards[cardCount++] = pair.second;
-    }
-    
-    std::sort(sortedCards.begin(), sortedCards.begin() + cardCount,
-        [](Card* a, Card* b) { return a->getValue() < b->getValue(); });
-    
-    int straightCount = 0;
-    for (int i = 0; i < cardCount - 4; ++i) {
-        bool isStraight = true;
-        for (int j = 0; j < 4; ++j) {
-            if (sortedCards[i + j + 1]->getValue() != sortedCards[i + j]->getValue() + 1) {
-                isStraight = false;
-                break;
-            }
-        }
-        if (isStraight) {
-            for (int j = 0; j < 5; ++j) {
-                cardPatterns["straight"][straightCount++] = sortedCards[i + j];
-            }
-            patternCounts[2] = straightCount;
+        if (move.cards & pair.second->getMask()) {
+            byIndex[pair.second->getIndex()] = pair.second;
         }
     }
+    int count = 0;
+    for (CardMask cards = move.cards; cards != 0 && count < 5; ) {
+        play[count++] = byIndex[popLowestCard(cards)];
+    }
+    return play;
 }
 
 std::array<Card*, 5> AIPlayer::makeMove(const std::array<Card*, 5>& lastPlayed, int lastPlayedCount) {
-    if (lastPlayedCount == 0) {
-        // First play of the game
-        return findLowestValidPlay(lastPlayed, lastPlayedCount);
+    Move trick = HandEvaluator::evaluate(lastPlayed.data(), std::min(lastPlayedCount, 5));
+    candidates.clear();
+    MoveGenerator::generate(handMask, trick, candidates);
+    if (!trick.isPass()) {
+        candidates.add(0, 0);
     }
-    
-    if (shouldPass(lastPlayed, lastPlayedCount)) {
-        return std::array<Card*, 5>(); // Empty array indicates pass
+    return toCards(decide(handMask, trick, candidates)); // Empty array indicates pass
+}
+
+Move AIPlayer::decide(CardMask hand, const Move& trick, const MoveList& legal) {
+    if (trick.isPass()) {
+        // Leading (including the first play of the game)
+        return findLowestValidPlay(hand, legal);
     }
-    
-    return findBestPlay(lastPlayed, lastPlayedCount);
+
+    if (shouldPass(hand, trick)) {
+        return Move{0, 0};
+    }
+
+    return findBestPlay(legal);
 }
 
-bool AIPlayer::shouldPass(const std::array<Card*, 5>& lastPlayed, int lastPlayedCount) {
+bool AIPlayer::shouldPass(CardMask hand, const Move& trick) {
     if (difficulty == 1) {
         // Easy AI: 30% chance to pass
-        return (rand() % 100) < 30;
+        return (rng() % 100) < 30;
     }
-    
-    // Count remaining cards of each value
-    int valueCount[15] = {0}; // 0-14 for card values
-    for (const auto& pair : hand) {
-        valueCount[pair.second->getValue()]++;
-    }
-    
+
     // If we have few cards left, be more aggressive
-    if (getHandSize() <= 3) {
+    int handSize = countCards(hand);
+    if (handSize <= 3) {
         return false;
     }
-    
+
     // If we have many high cards, be more conservative
-    int highCardCount = 0;
-    for (int i = 10; i <= 14; ++i) {
-        highCardCount += valueCount[i];
-    }
-    
-    // Consider the last played card if available
-    if (lastPlayedCount > 0 && lastPlayed[0] != nullptr) {
-        int lastValue = lastPlayed[0]->getValue();
-        // If last played card is high, be more likely to pass
-        if (lastValue >= 10) {
-            return true;
-        }
+    CardMask highCards = 0;
+    for (int value = 10; value <= 14; ++value) {
+        highCards |= rankMask(value);
+    }
+    int highCardCount = countCards(hand & highCards);
+
+    // If the highest card on the table is high, be more likely to pass
+    if (indexValue(highestCard(trick.cards)) >= 10) {
+        return true;
     }
-    
+
     if (difficulty == 2) {
         return highCardCount > 5;
     } else {
         // Hard AI: More strategic passing
-        return highCardCount > 3 && getHandSize() > 5;
+        return highCardCount > 3 && handSize > 5;
     }
 }
 
-std::array<Card*, 5> AIPlayer::findBestPlay(const std::array<Card*, 5>& lastPlayed, int lastPlayedCount) {
+Move AIPlayer::findBestPlay(const MoveList& legal) const {
+    Move bestPlay = findLowestValidPlay(0, legal);
     if (difficulty == 1) {
-        return findLowestValidPlay(lastPlayed, lastPlayedCount);
-    }
-    
-    std::array<Card*, 5> bestPlay = findLowestValidPlay(lastPlayed, lastPlayedCount);
-    std::array<Card*, 5> highestPlay = findHighestValidPlay(lastPlayed, lastPlayedCount);
-    
-    int bestCount = 0, highestCount = 0;
-    for (int i = 0; i < 5; ++i) {
-        if (bestPlay[i]) bestCount++;
-        if (highestPlay[i]) highestCount++;
-    }
-    
-    if (isBetterPlay(highestPlay, highestCount, bestPlay, bestCount)) {
+        return bestPlay;
+    }
+
+    Move highestPlay = findHighestValidPlay(legal);
+    if (isBetterPlay(highestPlay, bestPlay)) {
         return highestPlay;
     }
     return bestPlay;
 }
 
-std::array<Card*, 5> AIPlayer::findLowestValidPlay(const std::array<Card*, 5>& lastPlayed, int lastPlayedCount) {
-    std::array<Card*, 5> play;
-    std::fill(play.begin(), play.end(), nullptr);
-    
-    // If no last play, play lowest single card
-    if (lastPlayedCount == 0) {
-        Card* lowestCard = nullptr;
-        for (const auto& pair : hand) {
-            if (!lowestCard || *pair.second < *lowestCard) {
-                lowestCard = pair.second;
+Move AIPlayer::findLowestValidPlay(CardMask hand, const MoveList& legal) const {
+    const Move* choice = nullptr;
+
+    // When leading, play the largest combination that gets rid of the lowest card
+    if (hand != 0) {
+        CardMask lowest = cardBit(lowestCard(hand));
+        for (const Move& move : legal) {
+            if ((move.cards & lowest) &&
+                (!choice || move.size() > choice->size() ||
+                 (move.size() == choice->size() && move.key < choice->key))) {
+                choice = &move;
             }
         }
-        if (lowestCard) {
-            play[0] = lowestCard;
+        if (choice) {
+            return *choice;
         }
-        return play;
     }
-    
-    // Find lowest valid play that beats last play
-    for (const auto& pair : hand) {
-        if (*pair.second > *lastPlayed[0]) {
-            play[0] = pair.second;
-            return play;
+
+    // Otherwise the lowest play that beats the trick
+    for (const Move& move : legal) {
+        if (!move.isPass() && (!choice || move.key < choice->key)) {
+            choice = &move;
         }
     }
-    
-    return play; // Empty array indicates no valid play
+    return choice ? *choice : Move{0, 0}; // A pass indicates no valid play
 }
 
-std::array<Card*, 5> AIPlayer::findHighestValidPlay(const std::array<Card*, 5>& lastPlayed, int lastPlayedCount) {
-    std::array<Card*, 5> play;
-    std::fill(play.begin(), play.end(), nullptr);
-    
-    // If no last play, play highest single card
-    if (lastPlayedCount == 0) {
-        Card* highestCard = nullptr;
-        for (const auto& pair : hand) {
-            if (!highestCard || *pair.second > *highestCard) {
-                highestCard = pair.second;
-            }
-        }
-        if (highestCard) {
-            play[0] = highestCard;
-        }
-        return play;
-    }
-    
-    // Find highest valid play that beats last play
-    Card* highestCard = nullptr;
-    for (const auto& pair : hand) {
-        if (*pair.second > *lastPlayed[0] && (!highestCard || *pair.second > *highestCard)) {
-            highestCard = pair.second;
+Move AIPlayer::findHighestValidPlay(const MoveList& legal) const {
+    const Move* choice = nullptr;
+    for (const Move& move : legal) {
+        if (!move.isPass() && (!choice || move.key > choice->key)) {
+            choice = &move;
         }
     }
-    if (highestCard) {
-        play[0] = highestCard;
-    }
-    
-    return play;
+    return choice ? *choice : Move{0, 0};
 }
 
-bool AIPlayer::isBetterPlay(const std::array<Card*, 5>& play1, int count1,
-                           const std::array<Card*, 5>& play2, int count2) {
-    if (count1 == 0) return false;
-    if (count2 == 0) return true;
-    
+bool AIPlayer::isBetterPlay(const Move& play1, const Move& play2) const {
+    if (play1.isPass()) return false;
+    if (play2.isPass()) return true;
+
     // Compare the highest card in each play
-    Card* highest1 = nullptr;
-    Card* highest2 = nullptr;
-    
-    for (int i = 0; i < count1; ++i) {
-        if (!highest1 || *play1[i] > *highest1) {
-            highest1 = play1[i];
-        }
-    }
-    
-    for (int i = 0; i < count2; ++i) {
-        if (!highest2 || *play2[i] > *highest2) {
-            highest2 = play2[i];
-        }
-    }
-    
-    return *highest1 > *highest2;
-} 
\ No newline at end of file
+    return indexValue(highestCard(play1.cards)) > indexValue(highestCard(play2.cards));
+}
\ No newline at end of file
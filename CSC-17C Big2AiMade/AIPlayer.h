@@ -2,45 +2,79 @@
 #define AIPLAYER_H
 
 #include "Player.h"
+#include "Agent.h"
+#include "MoveGenerator.h"
+#include "EndgameSolver.h"
 #include <array>
-#include <map>
+#include <memory>
+#include <random>
 
 /*
 CLASS: AIPlayer
-PURPOSE: Represents an AI player in the Big 2 game
-INHERITS: Player
+PURPOSE: Represents an AI player in the Big 2 game. Decisions work on card masks, so the same logic
+         plays Card hands (makeMove) and GameEngine seats (chooseMove). In engine games, once at
+         most endgameCards cards are left in all hands, it deals the hidden cards a few ways and
+         plays the move the EndgameSolver proves winning in the most deals, falling back to the
+         heuristics when none is.
+INHERITS: Player, Agent
 ATTRIBUTES:
     - difficulty: int (1-3, where 3 is hardest)
-    - cardPatterns: map<string, array<Card*, 5>>
+    - rng: minstd_rand (cheap to reseed; reseeded by newGame so engine games replay exactly)
+    - candidates: MoveList (scratch buffer for the moves that beat a trick)
+    - endgameCards: int (0 turns the endgame solver off)
+    - solver: unique_ptr<EndgameSolver> (created on first use)
 METHODS:
     + AIPlayer(name: string, difficulty: int)
     + ~AIPlayer()
+    + getDifficulty(): int
+    + getEndgameCards(): int
+    + setEndgameCards(cards: int): void
+    + decide(hand: CardMask, trick: Move, legal: MoveList): Move
     + makeMove(lastPlayed: array<Card*, 5>, count: int): array<Card*, 5>
-    + analyzeHand(): void
-    + findBestPlay(lastPlayed: array<Card*, 5>, count: int): array<Card*, 5>
-    + shouldPass(lastPlayed: array<Card*, 5>, count: int): bool
+    + newGame(seat: int, seed: uint64_t): void
+    + chooseMove(engine: GameEngine, legal: MoveList): Move
+    + findBestPlay(legal: MoveList): Move
+    + solveEndgame(engine: GameEngine, legal: MoveList, choice: Move&): bool
+    + shouldPass(hand: CardMask, trick: Move): bool
+    + toCards(move: Move): array<Card*, 5>
 DATE: 2024-03-19
 */
 
-class AIPlayer : public Player {
+class AIPlayer : public Player, public Agent {
 private:
     int difficulty;
-    std::map<std::string, std::array<Card*, 5>> cardPatterns;
-    int patternCounts[5]; // Count of cards in each pattern
+    std::minstd_rand rng;
+    MoveList candidates;
+    int endgameCards;
+    std::unique_ptr<EndgameSolver> solver;
 
     // Helper methods
-    void analyzeHand();
-    std::array<Card*, 5> findBestPlay(const std::array<Card*, 5>& lastPlayed, int lastPlayedCount);
-    bool shouldPass(const std::array<Card*, 5>& lastPlayed, int lastPlayedCount);
-    std::array<Card*, 5> findLowestValidPlay(const std::array<Card*, 5>& lastPlayed, int lastPlayedCount);
-    std::array<Card*, 5> findHighestValidPlay(const std::array<Card*, 5>& lastPlayed, int lastPlayedCount);
-    bool isBetterPlay(const std::array<Card*, 5>& play1, int count1, 
-                     const std::array<Card*, 5>& play2, int count2);
+    Move findBestPlay(const MoveList& legal) const;
+    bool solveEndgame(const GameEngine& engine, const MoveList& legal, Move& choice);
+    bool shouldPass(CardMask hand, const Move& trick);
+    Move findLowestValidPlay(CardMask hand, const MoveList& legal) const;
+    Move findHighestValidPlay(const MoveList& legal) const;
+    std::array<Card*, 5> toCards(const Move& move) const;
+    bool isBetterPlay(const Move& play1, const Move& play2) const;
 
 public:
+    // Deals of the hidden cards solved per endgame move
+    static const int ENDGAME_SAMPLES = 16;
+
+    // Easy AI plays on heuristics alone; the others solve endgames of at most 20 cards
     AIPlayer(const std::string& name, int diff = 2);
     ~AIPlayer();
+    int getDifficulty() const { return difficulty; }
+    int getEndgameCards() const { return endgameCards; }
+    void setEndgameCards(int cards) { endgameCards = cards; }
+
+    // Picks one of the legal moves for hand on trick (a pass trick means leading)
+    Move decide(CardMask hand, const Move& trick, const MoveList& legal);
     std::array<Card*, 5> makeMove(const std::array<Card*, 5>& lastPlayed, int lastPlayedCount);
+
+    // Agent interface
+    void newGame(int seat, std::uint64_t seed) override;
+    Move chooseMove(const GameEngine& engine, const MoveList& legal) override;
 };
 
-#endif 
\ No newline at end of file
+#endif
\ No newline at end of file
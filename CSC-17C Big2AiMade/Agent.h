@@ -0,0 +1,33 @@
+#ifndef AGENT_H
+#define AGENT_H
+
+#include "MoveGenerator.h"
+#include <cstdint>
+
+class GameEngine;
+
+/*
+CLASS: Agent
+PURPOSE: Interface for anything that picks moves for a seat in a GameEngine game (AI or human)
+METHODS:
+    + newGame(seat: int, seed: uint64_t): void
+    + observeMove(engine: GameEngine, player: int, move: Move): void
+    + chooseMove(engine: GameEngine, legal: MoveList): Move
+DATE: 2026-10-19
+*/
+
+class Agent {
+public:
+    virtual ~Agent() {}
+
+    // Called before each game, so randomized agents can be replayed from the game's seed
+    virtual void newGame(int /*seat*/, std::uint64_t /*seed*/) {}
+
+    // Called for every player's move, before it is applied, so agents can track the history
+    virtual void observeMove(const GameEngine& /*engine*/, int /*player*/, const Move& /*move*/) {}
+
+    // Must return one of the legal moves; the current player is engine.getCurrentPlayer()
+    virtual Move chooseMove(const GameEngine& engine, const MoveList& legal) = 0;
+};
+
+#endif
\ No newline at end of file
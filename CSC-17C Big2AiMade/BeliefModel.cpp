@@ -0,0 +1,191 @@
+#include "BeliefModel.h"
+#include "GameEngine.h"
+#include <algorithm>
+
+const double BeliefModel::VOID_WEIGHT = 0.05;
+const double BeliefModel::DEFAULT_PASS_CONFIDENCE = 0.5;
+
+namespace {
+
+// Tries with card weights before sample deals the remaining cards uniformly
+const int SAMPLE_ATTEMPTS = 8;
+
+inline std::uint64_t nextRandom(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Uniform in [0, 1)
+inline double nextUnit(std::uint64_t& state) {
+    return (nextRandom(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+}  // namespace
+
+BeliefModel::BeliefModel(double confidence)
+    : player(0), hand(0), unseen(0) {
+    for (int other = 0; other < NUM_PLAYERS; other++) {
+        passConfidence[other] = confidence;
+        handSizes[other] = 0;
+        for (int card = 0; card < NUM_CARDS; card++) {
+            weights[other][card] = 1.0f;
+        }
+    }
+}
+
+void BeliefModel::setPassConfidence(int other, double confidence) {
+    passConfidence[other] = std::min(1.0, std::max(0.0, confidence));
+}
+
+void BeliefModel::reset(const GameEngine& engine, int seat) {
+    player = seat;
+    hand = engine.getHand(player);
+    unseen = FULL_DECK & ~engine.getPlayedCards() & ~hand;
+    for (int other = 0; other < NUM_PLAYERS; other++) {
+        handSizes[other] = engine.getCardsLeft(other);
+        for (int card = 0; card < NUM_CARDS; card++) {
+            weights[other][card] = 1.0f;
+        }
+    }
+}
+
+bool BeliefModel::isCurrent(const GameEngine& engine) const {
+    if (hand != engine.getHand(player) || unseen != (FULL_DECK & ~engine.getPlayedCards() & ~hand)) {
+        return false;
+    }
+    for (int other = 0; other < NUM_PLAYERS; other++) {
+        if (handSizes[other] != engine.getCardsLeft(other)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void BeliefModel::scaleWeights(int other, CardMask cards, double factor) {
+    for (cards &= unseen; cards != 0; ) {
+        int card = popLowestCard(cards);
+        weights[other][card] = static_cast<float>(weights[other][card] * factor);
+    }
+}
+
+void BeliefModel::observe(const GameEngine& engine, int mover, const Move& move) {
+    if (!move.isPass()) {
+        if (mover == player) {
+            hand &= ~move.cards;
+        } else {
+            unseen &= ~move.cards;
+        }
+        handSizes[mover] -= move.size();
+        return;
+    }
+
+    const Move& trick = engine.getTrick();
+    if (mover == player || trick.isPass()) {
+        return;
+    }
+
+    // Cards that could have beaten the trick become less likely in the passer's hand. Passing on a
+    // pair or triple only rules out holding two or three of them, so one such card is never a void.
+    CardMask above = cardsAbove(highestCard(trick.cards));
+    switch (trick.getType()) {
+        case SINGLE:
+            scaleWeights(mover, above, 1.0 - passConfidence[mover]);
+            break;
+        case PAIR:
+            scaleWeights(mover, above, 1.0 - passConfidence[mover] / 2);
+            break;
+        case TRIPLE:
+            scaleWeights(mover, above & ~rankMask(indexValue(highestCard(trick.cards))),
+                         1.0 - passConfidence[mover] / 3);
+            break;
+        default:
+            break;  // Five-card hands say too little about single cards
+    }
+}
+
+CardMask BeliefModel::getVoids(int other) const {
+    if (other == player) {
+        return FULL_DECK & ~hand;
+    }
+    CardMask voids = FULL_DECK & ~unseen;
+    for (CardMask cards = unseen; cards != 0; ) {
+        int card = popLowestCard(cards);
+        if (weights[other][card] < VOID_WEIGHT) {
+            voids |= cardBit(card);
+        }
+    }
+    return voids;
+}
+
+double BeliefModel::holdProbability(int other, int card) const {
+    if (other == player) {
+        return (hand & cardBit(card)) ? 1.0 : 0.0;
+    }
+    if ((unseen & cardBit(card)) == 0) {
+        return 0.0;
+    }
+    double total = 0;
+    for (int candidate = 0; candidate < NUM_PLAYERS; candidate++) {
+        if (candidate != player) {
+            total += weights[candidate][card] * handSizes[candidate];
+        }
+    }
+    return total > 0 ? weights[other][card] * handSizes[other] / total : 0.0;
+}
+
+bool BeliefModel::sample(std::array<CardMask, 4>& hands, std::uint64_t& randomState) const {
+    int cards[NUM_CARDS];
+    int count = 0;
+    for (CardMask left = unseen; left != 0; ) {
+        cards[count++] = popLowestCard(left);
+    }
+
+    for (int attempt = 0; attempt <= SAMPLE_ATTEMPTS; attempt++) {
+        // The last attempt ignores the weights, so it always completes
+        bool weighted = attempt < SAMPLE_ATTEMPTS;
+        int slots[NUM_PLAYERS];
+        for (int other = 0; other < NUM_PLAYERS; other++) {
+            hands[other] = 0;
+            slots[other] = other == player ? 0 : handSizes[other];
+        }
+        hands[player] = hand;
+
+        // Deal in a fresh random order each attempt
+        bool complete = true;
+        for (int i = 0; i < count && complete; i++) {
+            int pick = i + static_cast<int>(nextUnit(randomState) * (count - i));
+            int card = cards[pick];
+            cards[pick] = cards[i];
+            cards[i] = card;
+
+            double shares[NUM_PLAYERS];
+            double total = 0;
+            for (int other = 0; other < NUM_PLAYERS; other++) {
+                shares[other] = slots[other] * (weighted ? weights[other][card] : 1.0f);
+                total += shares[other];
+            }
+            if (total <= 0) {
+                complete = false;
+                break;
+            }
+
+            double target = nextUnit(randomState) * total;
+            int receiver = 0;
+            while (receiver < NUM_PLAYERS - 1 && (shares[receiver] == 0 || target >= shares[receiver])) {
+                target -= shares[receiver];
+                receiver++;
+            }
+            while (shares[receiver] == 0) {
+                receiver--;  // Rounding ran past the last player with a share
+            }
+            hands[receiver] |= cardBit(card);
+            slots[receiver]--;
+        }
+        if (complete) {
+            return weighted;
+        }
+    }
+    return false;
+}
\ No newline at end of file
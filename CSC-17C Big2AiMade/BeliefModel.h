@@ -0,0 +1,91 @@
+#ifndef BELIEFMODEL_H
+#define BELIEFMODEL_H
+
+#include "CardMask.h"
+#include "MoveGenerator.h"
+#include <array>
+#include <cstdint>
+
+class GameEngine;
+
+/*
+CLASS: BeliefModel
+PURPOSE: One player's view of where the hidden cards are, updated move by move: the cards not yet
+         seen, every hand size, and a weight per opponent and card. Passing on a trick is allowed
+         in Big 2, so a pass is soft evidence: it scales down the weights of the cards that could
+         have beaten the trick (fully for singles, less for pairs and triples, which a single
+         high card cannot beat). Cards whose weight falls below VOID_WEIGHT count as voids.
+         sample deals the unseen cards to the opponents with their exact hand sizes, each card
+         going to a player in proportion to weight times free slots.
+ATTRIBUTES:
+    - player: int
+    - passConfidence: double[4] (per player: 0 ignores passes, 1 makes a pass a hard void)
+    - hand: CardMask
+    - unseen: CardMask
+    - handSizes: int[4]
+    - weights: float[4][52]
+METHODS:
+    + BeliefModel(passConfidence: double)
+    + setPassConfidence(player: int, confidence: double): void
+    + getPassConfidence(player: int): double
+    + reset(engine: GameEngine, player: int): void
+    + observe(engine: GameEngine, player: int, move: Move): void
+    + isCurrent(engine: GameEngine): bool
+    + getUnseen(): CardMask
+    + getHandSize(player: int): int
+    + getWeight(player: int, card: int): double
+    + getVoids(player: int): CardMask
+    + holdProbability(player: int, card: int): double
+    + sample(hands: array<CardMask, 4>&, randomState: uint64_t&): bool
+DATE: 2026-10-19
+*/
+
+class BeliefModel {
+public:
+    static const int NUM_PLAYERS = 4;
+
+    // Weight below which a card counts as a void for that player
+    static const double VOID_WEIGHT;
+
+    // Pass confidence for players nobody has measured; MCTSPlayer learns one per opponent
+    static const double DEFAULT_PASS_CONFIDENCE;
+
+    explicit BeliefModel(double passConfidence = DEFAULT_PASS_CONFIDENCE);
+
+    // How far other's later passes are trusted; kept by reset
+    void setPassConfidence(int other, double confidence);
+    double getPassConfidence(int other) const { return passConfidence[other]; }
+
+    // Starts from what player knows at the engine's current position (no history)
+    void reset(const GameEngine& engine, int player);
+
+    // Records a move; engine must be the position before the move is applied
+    void observe(const GameEngine& engine, int player, const Move& move);
+
+    // False when moves were applied to the engine without being observed
+    bool isCurrent(const GameEngine& engine) const;
+
+    CardMask getUnseen() const { return unseen; }
+    int getHandSize(int other) const { return handSizes[other]; }
+    double getWeight(int other, int card) const { return weights[other][card]; }
+    CardMask getVoids(int other) const;
+
+    // Estimated chance that other holds card (0 for our own and played cards)
+    double holdProbability(int other, int card) const;
+
+    // Fills hands with our hand and a weighted deal of the unseen cards to the opponents. Returns
+    // false if the weights could not be met and some cards were dealt ignoring them.
+    bool sample(std::array<CardMask, 4>& hands, std::uint64_t& randomState) const;
+
+private:
+    int player;
+    double passConfidence[NUM_PLAYERS];
+    CardMask hand;
+    CardMask unseen;
+    int handSizes[NUM_PLAYERS];
+    float weights[NUM_PLAYERS][NUM_CARDS];
+
+    void scaleWeights(int other, CardMask cards, double factor);
+};
+
+#endif
\ No newline at end of file
@@ -1,56 +1,55 @@
 #include "Card.h"
+#include <stdexcept>
 
-// Initialize static member
-std::set<std::string> Card::validSuits = {"hearts", "diamonds", "clubs", "spades"};
-
-Card::Card(const std::string& s, int r) : suit(s), rank(r) {
-    if (!isValidSuit(s)) {
+Card::Card(const std::string& s, int r) {
+    int suit = suitIndex(s);
+    if (suit < 0) {
         throw std::invalid_argument("Invalid suit");
     }
-    
+    if (r < 2 || r > 14) {
+        throw std::invalid_argument("Invalid rank");
+    }
+
     // Calculate Big 2 specific value
     // In Big 2, 2 is highest, followed by A, K, Q, J, 10-3
-    if (rank == 2) value = 15;
-    else if (rank == 14) value = 14; // Ace
-    else value = rank;
+    int value = (r == 2) ? HIGHEST_VALUE : r;
+    index = static_cast<CardIndex>(cardIndex(value, suit));
+}
+
+Card::Card(int index) : index(static_cast<CardIndex>(index)) {
+    if (index < 0 || index >= NUM_CARDS) {
+        throw std::invalid_argument("Invalid card index");
+    }
 }
 
 std::string Card::getSuit() const {
-    return suit;
+    return suitName(indexSuit(index));
 }
 
 int Card::getRank() const {
-    return rank;
+    return indexRank(index);
 }
 
 int Card::getValue() const {
-    return value;
+    return indexValue(index);
 }
 
 bool Card::operator<(const Card& other) const {
-    return value < other.value;
+    return getValue() < other.getValue();
 }
 
 bool Card::operator==(const Card& other) const {
-    return value == other.value;
+    return getValue() == other.getValue();
 }
 
 bool Card::operator>(const Card& other) const {
-    return value > other.value;
+    return getValue() > other.getValue();
 }
 
 bool Card::isValidSuit(const std::string& s) {
-    return validSuits.find(s) != validSuits.end();
+    return suitIndex(s) >= 0;
 }
 
 std::string Card::toString() const {
-    std::string rankStr;
-    switch(rank) {
-        case 11: rankStr = "J"; break;
-        case 12: rankStr = "Q"; break;
-        case 13: rankStr = "K"; break;
-        case 14: rankStr = "A"; break;
-        default: rankStr = std::to_string(rank);
-    }
-    return rankStr + suit[0];
-} 
\ No newline at end of file
+    return cardName(index);
+}
\ No newline at end of file
@@ -1,22 +1,24 @@
 #ifndef CARD_H
 #define CARD_H
 
+#include "CardMask.h"
 #include <string>
 #include <iostream>
-#include <set>
 
 /*
 CLASS: Card
-PURPOSE: Represents a playing card in the Big 2 game
+PURPOSE: Represents a playing card in the Big 2 game (a view over its CardMask index)
 ATTRIBUTES:
-    - suit: string (hearts, diamonds, clubs, spades)
-    - rank: int (2-14, where 14 is Ace)
-    - value: int (Big 2 specific value)
+    - index: CardIndex (position in the 52-bit CardMask layout; suit, rank and value derive from it)
 METHODS:
     + Card(suit: string, rank: int)
+    + Card(index: int)
     + getSuit(): string
+    + getSuitIndex(): int
     + getRank(): int
     + getValue(): int
+    + getIndex(): int
+    + getMask(): CardMask
     + operator<(const Card& other): bool
     + operator==(const Card& other): bool
     + operator>(const Card& other): bool
@@ -26,23 +28,24 @@ DATE: 2024-03-19
 
 class Card {
 private:
-    std::string suit;
-    int rank;
-    int value;
-    static std::set<std::string> validSuits;
+    CardIndex index;
 
 public:
     Card(const std::string& s, int r);
+    explicit Card(int index);
     std::string getSuit() const;
+    int getSuitIndex() const { return indexSuit(index); }
     int getRank() const;
     int getValue() const;
+    int getIndex() const { return index; }
+    CardMask getMask() const { return cardBit(index); }
     bool operator<(const Card& other) const;
     bool operator==(const Card& other) const;
     bool operator>(const Card& other) const;
     std::string toString() const;
-    
+
     // Static method to validate suit
     static bool isValidSuit(const std::string& s);
 };
 
-#endif 
\ No newline at end of file
+#endif
\ No newline at end of file
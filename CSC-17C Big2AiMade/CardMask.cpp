@@ -0,0 +1,40 @@
+#include "CardMask.h"
+
+static const char* const SUIT_NAMES[NUM_SUITS] = {"diamonds", "clubs", "hearts", "spades"};
+
+int suitIndex(const std::string& name) {
+    for (int suit = 0; suit < NUM_SUITS; suit++) {
+        if (name == SUIT_NAMES[suit]) {
+            return suit;
+        }
+    }
+    return -1;
+}
+
+std::string suitName(int suit) {
+    return SUIT_NAMES[suit];
+}
+
+std::string cardName(int index) {
+    std::string rankStr;
+    int rank = indexRank(index);
+    switch(rank) {
+        case 11: rankStr = "J"; break;
+        case 12: rankStr = "Q"; break;
+        case 13: rankStr = "K"; break;
+        case 14: rankStr = "A"; break;
+        default: rankStr = std::to_string(rank);
+    }
+    return rankStr + SUIT_NAMES[indexSuit(index)][0];
+}
+
+std::string maskToString(CardMask mask) {
+    std::string result;
+    while (mask != 0) {
+        if (!result.empty()) {
+            result += ' ';
+        }
+        result += cardName(popLowestCard(mask));
+    }
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+#ifndef CARDMASK_H
+#define CARDMASK_H
+
+#include <cstdint>
+#include <string>
+
+/*
+HEADER: CardMask
+PURPOSE: Bitboard representation of Big 2 cards and hands. A card is an 8-bit index and a hand is a
+         52-bit mask, so membership, set operations and counts per rank or suit are single
+         and/or/popcount instructions.
+LAYOUT: index = (value - 3) * 4 + suit, where value is the Big 2 value (3-15, 2 is highest) and
+        suit is 0 diamonds, 1 clubs, 2 hearts, 3 spades. Index order is Big 2 card order, so
+        bit 0 is the 3 of diamonds and bit 51 the 2 of spades; each rank owns one nibble.
+FUNCTIONS:
+    + cardIndex(value: int, suit: int): int
+    + indexValue(index: int): int
+    + indexSuit(index: int): int
+    + indexRank(index: int): int
+    + cardBit(index: int): CardMask
+    + countCards(mask: CardMask): int
+    + lowestCard(mask: CardMask): int
+    + highestCard(mask: CardMask): int
+    + popLowestCard(mask: CardMask&): int
+    + rankMask(value: int): CardMask
+    + suitMask(suit: int): CardMask
+    + countRank(mask: CardMask, value: int): int
+    + countSuit(mask: CardMask, suit: int): int
+    + cardsAbove(index: int): CardMask
+    + suitIndex(name: string): int
+    + suitName(suit: int): string
+    + cardName(index: int): string
+    + maskToString(mask: CardMask): string
+DATE: 2026-10-19
+*/
+
+typedef std::uint64_t CardMask;
+typedef std::uint8_t CardIndex;
+
+const int NUM_CARDS = 52;
+const int NUM_RANKS = 13;
+const int NUM_SUITS = 4;
+const int LOWEST_VALUE = 3;
+const int HIGHEST_VALUE = 15;
+
+enum Suit { DIAMONDS = 0, CLUBS = 1, HEARTS = 2, SPADES = 3 };
+
+const CardMask FULL_DECK = (CardMask(1) << NUM_CARDS) - 1;
+const CardMask SUIT_PATTERN = 0x1111111111111ULL;  // Lowest bit of every rank nibble
+const int THREE_OF_DIAMONDS = 0;
+
+inline int cardIndex(int value, int suit) {
+    return (value - LOWEST_VALUE) * NUM_SUITS + suit;
+}
+
+inline int indexValue(int index) {
+    return index / NUM_SUITS + LOWEST_VALUE;
+}
+
+inline int indexSuit(int index) {
+    return index & 3;
+}
+
+// Face rank (2-14, 14 is Ace) as Card stores it
+inline int indexRank(int index) {
+    int value = indexValue(index);
+    return value == HIGHEST_VALUE ? 2 : value;
+}
+
+inline CardMask cardBit(int index) {
+    return CardMask(1) << index;
+}
+
+inline int countCards(CardMask mask) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(mask);
+#else
+    int count = 0;
+    for (; mask != 0; mask &= mask - 1) {
+        count++;
+    }
+    return count;
+#endif
+}
+
+// Index of the lowest card (mask must not be empty)
+inline int lowestCard(CardMask mask) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(mask);
+#else
+    int index = 0;
+    while ((mask & 1) == 0) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+// Index of the highest card (mask must not be empty)
+inline int highestCard(CardMask mask) {
+#if defined(__GNUC__)
+    return 63 - __builtin_clzll(mask);
+#else
+    int index = 63;
+    while ((mask & (CardMask(1) << 63)) == 0) {
+        mask <<= 1;
+        index--;
+    }
+    return index;
+#endif
+}
+
+// Remove the lowest card from mask and return its index
+inline int popLowestCard(CardMask& mask) {
+    int index = lowestCard(mask);
+    mask &= mask - 1;
+    return index;
+}
+
+// All four cards of a Big 2 value
+inline CardMask rankMask(int value) {
+    return CardMask(0xF) << ((value - LOWEST_VALUE) * NUM_SUITS);
+}
+
+// All thirteen cards of a suit
+inline CardMask suitMask(int suit) {
+    return SUIT_PATTERN << suit;
+}
+
+inline int countRank(CardMask mask, int value) {
+    return countCards(mask & rankMask(value));
+}
+
+inline int countSuit(CardMask mask, int suit) {
+    return countCards(mask & suitMask(suit));
+}
+
+// Every card that beats the given card as a single
+inline CardMask cardsAbove(int index) {
+    return FULL_DECK & ~((CardMask(2) << index) - 1);
+}
+
+// Suit index for "diamonds", "clubs", "hearts" or "spades" (-1 for anything else)
+int suitIndex(const std::string& name);
+
+std::string suitName(int suit);
+
+// Short name as Card::toString prints it ("10h", "As")
+std::string cardName(int index);
+
+// Space-separated card names, lowest first
+std::string maskToString(CardMask mask);
+
+#endif
\ No newline at end of file
@@ -1,13 +1,9 @@
 #include "Deck.h"
 
 Deck::Deck() : currentIndex(0) {
-    const std::string suits[] = {"hearts", "diamonds", "clubs", "spades"};
-    
-    // Create all 52 cards using transform
-    for (const auto& suit : suits) {
-        for (int rank = 2; rank <= 14; rank++) {
-            cards.push_back(new Card(suit, rank));
-        }
+    // Create all 52 cards in CardMask index order
+    for (int index = 0; index < NUM_CARDS; index++) {
+        cards.push_back(new Card(index));
     }
 }
 
@@ -0,0 +1,262 @@
+#include "EndgameSolver.h"
+#include <algorithm>
+#include <array>
+
+namespace {
+
+const std::uint64_t VALID_BIT = 1ULL << 53;
+const std::uint64_t WIN_BIT = 1ULL << 52;
+
+inline std::uint64_t nextRandom(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Random keys for every part of a position; fixed, so hashes are the same on every run
+struct ZobristKeys {
+    std::uint64_t hand[GameEngine::NUM_PLAYERS][NUM_CARDS];
+    std::uint64_t trick[NUM_CARDS];
+    std::uint64_t toMove[GameEngine::NUM_PLAYERS];
+    std::uint64_t trickOwner[GameEngine::NUM_PLAYERS];
+    std::uint64_t passes[GameEngine::NUM_PLAYERS];
+    std::uint64_t solvingFor[GameEngine::NUM_PLAYERS];
+    std::uint64_t firstMove;
+
+    ZobristKeys() {
+        std::uint64_t state = 0x5A0B21575EEDULL;
+        for (int player = 0; player < GameEngine::NUM_PLAYERS; player++) {
+            for (int card = 0; card < NUM_CARDS; card++) {
+                hand[player][card] = nextRandom(state);
+            }
+            toMove[player] = nextRandom(state);
+            trickOwner[player] = nextRandom(state);
+            passes[player] = nextRandom(state);
+            solvingFor[player] = nextRandom(state);
+        }
+        for (int card = 0; card < NUM_CARDS; card++) {
+            trick[card] = nextRandom(state);
+        }
+        firstMove = nextRandom(state);
+    }
+};
+
+const ZobristKeys KEYS;
+
+// The trick's cards decide its key, so they are all the hash needs
+inline std::uint64_t trickHash(const Move& trick) {
+    std::uint64_t hash = 0;
+    for (CardMask cards = trick.cards; cards != 0; ) {
+        hash ^= KEYS.trick[popLowestCard(cards)];
+    }
+    return hash;
+}
+
+// Everything but the hands, which change one move at a time
+inline std::uint64_t turnHash(const GameEngine& state) {
+    return trickHash(state.getTrick()) ^ KEYS.toMove[state.getCurrentPlayer()] ^
+           KEYS.trickOwner[state.getTrickOwner()] ^ KEYS.passes[state.getPassCount()] ^
+           (state.isFirstMove() ? KEYS.firstMove : 0);
+}
+
+std::uint64_t positionHash(const GameEngine& state, int player) {
+    std::uint64_t hash = turnHash(state) ^ KEYS.solvingFor[player];
+    for (int other = 0; other < GameEngine::NUM_PLAYERS; other++) {
+        for (CardMask cards = state.getHand(other); cards != 0; ) {
+            hash ^= KEYS.hand[other][popLowestCard(cards)];
+        }
+    }
+    return hash;
+}
+
+// Updates hash for mover playing move from before, which led to after
+inline std::uint64_t childHash(std::uint64_t hash, const GameEngine& before, const GameEngine& after, int mover,
+                               const Move& move) {
+    for (CardMask cards = move.cards; cards != 0; ) {
+        hash ^= KEYS.hand[mover][popLowestCard(cards)];
+    }
+    return hash ^ turnHash(before) ^ turnHash(after);
+}
+
+// Search order: going out first, then bigger combinations, then cheaper ones; passing last
+void orderMoves(MoveList& moves, CardMask hand) {
+    std::sort(moves.moves, moves.moves + moves.count, [hand](const Move& a, const Move& b) {
+        bool aOut = a.cards == hand;
+        bool bOut = b.cards == hand;
+        if (aOut != bOut) {
+            return aOut;
+        }
+        int aSize = a.size();
+        int bSize = b.size();
+        if (aSize != bSize) {
+            return aSize > bSize;
+        }
+        return a.key < b.key;
+    });
+}
+
+// Upper bound on the plies left: every non-pass move plays a card and at most three passes follow it
+int maxDepth(const GameEngine& state) {
+    int cards = 0;
+    for (int player = 0; player < GameEngine::NUM_PLAYERS; player++) {
+        cards += state.getCardsLeft(player);
+    }
+    return GameEngine::NUM_PLAYERS * (cards + 1);
+}
+
+}  // namespace
+
+EndgameSolver::EndgameSolver(int tableBits)
+    : table(new Entry[static_cast<std::size_t>(1) << tableBits]),
+      tableMask((static_cast<std::uint64_t>(1) << tableBits) - 1) {
+    for (std::uint64_t i = 0; i <= tableMask; i++) {
+        table[i].check.store(0, std::memory_order_relaxed);
+        table[i].data.store(0, std::memory_order_relaxed);
+    }
+}
+
+bool EndgameSolver::probe(std::uint64_t hash, Outcome& outcome, CardMask& bestCards) const {
+    const Entry& entry = table[hash & tableMask];
+    std::uint64_t data = entry.data.load(std::memory_order_relaxed);
+    std::uint64_t check = entry.check.load(std::memory_order_relaxed);
+    if ((data & VALID_BIT) == 0 || (check ^ data) != hash) {
+        return false;
+    }
+    outcome = (data & WIN_BIT) ? WIN : LOSS;
+    bestCards = data & FULL_DECK;
+    return true;
+}
+
+void EndgameSolver::store(std::uint64_t hash, Outcome outcome, CardMask bestCards) const {
+    // Always replace: every entry is exact, and recent positions are the likeliest to repeat
+    Entry& entry = table[hash & tableMask];
+    std::uint64_t data = VALID_BIT | (outcome == WIN ? WIN_BIT : 0) | (bestCards & FULL_DECK);
+    entry.check.store(hash ^ data, std::memory_order_relaxed);
+    entry.data.store(data, std::memory_order_relaxed);
+}
+
+EndgameSolver::Outcome EndgameSolver::search(const GameEngine& state, std::uint64_t hash, int depth,
+                                             Search& context) const {
+    if (state.isTerminal()) {
+        return state.getWinner() == context.player ? WIN : LOSS;
+    }
+    Outcome outcome;
+    CardMask bestCards;
+    if (probe(hash, outcome, bestCards)) {
+        return outcome;
+    }
+    if (++context.nodes > context.nodeLimit) {
+        return UNKNOWN;
+    }
+
+    int mover = state.getCurrentPlayer();
+    MoveList& moves = context.stack[depth];
+    state.legalMoves(moves);
+    orderMoves(moves, state.getHand(mover));
+
+    // The solving player needs one winning move; the others need one move that beats them
+    Outcome cutoff = mover == context.player ? WIN : LOSS;
+    outcome = cutoff == WIN ? LOSS : WIN;
+    bestCards = 0;
+    for (int i = 0; i < moves.count; i++) {
+        const Move& move = moves[i];
+        GameEngine child = state;
+        child.apply(move);
+        Outcome result = search(child, childHash(hash, state, child, mover, move), depth + 1, context);
+        if (result == UNKNOWN) {
+            return UNKNOWN;
+        }
+        if (result == cutoff) {
+            outcome = cutoff;
+            bestCards = move.cards;
+            break;
+        }
+    }
+    store(hash, outcome, bestCards);
+    return outcome;
+}
+
+EndgameSolver::Outcome EndgameSolver::solve(const GameEngine& position, int player, long long nodeLimit,
+                                            Move* bestMove) const {
+    GameEngine state = position;
+    state.setObserver(nullptr);
+    Search context;
+    context.player = player;
+    context.nodes = 0;
+    context.nodeLimit = nodeLimit;
+    context.stack.resize(maxDepth(state));
+
+    std::uint64_t hash = positionHash(state, player);
+    Outcome outcome = search(state, hash, 0, context);
+    if (outcome == WIN && bestMove && !state.isTerminal() && state.getCurrentPlayer() == player) {
+        Outcome stored;
+        CardMask bestCards;
+        MoveList& moves = context.stack[0];
+        if (probe(hash, stored, bestCards)) {
+            state.legalMoves(moves);
+            for (const Move& move : moves) {
+                if (move.cards == bestCards) {
+                    *bestMove = move;
+                }
+            }
+        }
+    }
+    return outcome;
+}
+
+bool EndgameSolver::solveMoves(const GameEngine& position, const MoveList& legal, long long nodeLimit,
+                               std::vector<char>& wins) const {
+    GameEngine state = position;
+    state.setObserver(nullptr);
+    Search context;
+    context.nodeLimit = nodeLimit;
+    context.stack.resize(maxDepth(state));
+    return searchMoves(state, legal, context, wins);
+}
+
+bool EndgameSolver::searchMoves(const GameEngine& state, const MoveList& legal, Search& context,
+                                std::vector<char>& wins) const {
+    context.player = state.getCurrentPlayer();
+    context.nodes = 0;
+    std::uint64_t hash = positionHash(state, context.player);
+    wins.assign(legal.count, 0);
+    for (int i = 0; i < legal.count; i++) {
+        GameEngine child = state;
+        child.apply(legal[i]);
+        Outcome result = search(child, childHash(hash, state, child, context.player, legal[i]), 1, context);
+        if (result == UNKNOWN) {
+            return false;
+        }
+        wins[i] = result == WIN;
+    }
+    return true;
+}
+
+int EndgameSolver::countWins(const GameEngine& engine, const BeliefModel& belief, const MoveList& legal, int samples,
+                             std::uint64_t& randomState, std::vector<int>& wins) const {
+    wins.resize(legal.count, 0);
+    std::array<CardMask, 4> hands;
+    std::vector<char> dealWins;
+    GameEngine deal = engine;
+    deal.setObserver(nullptr);
+
+    // Every deal has the same card count, so one move stack serves them all
+    Search context;
+    context.nodeLimit = DEFAULT_NODE_LIMIT;
+    context.stack.resize(maxDepth(deal));
+
+    int solved = 0;
+    for (int sample = 0; sample < samples; sample++) {
+        belief.sample(hands, randomState);
+        deal.setHands(hands);
+        if (!searchMoves(deal, legal, context, dealWins)) {
+            continue;  // Too big to solve; skipping it keeps the counts exact
+        }
+        solved++;
+        for (int i = 0; i < legal.count; i++) {
+            wins[i] += dealWins[i];
+        }
+    }
+    return solved;
+}
\ No newline at end of file
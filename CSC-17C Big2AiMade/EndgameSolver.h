@@ -0,0 +1,83 @@
+#ifndef ENDGAMESOLVER_H
+#define ENDGAMESOLVER_H
+
+#include "BeliefModel.h"
+#include "GameEngine.h"
+#include "MoveGenerator.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/*
+CLASS: EndgameSolver
+PURPOSE: Exact perfect-information solver for small endgames. It asks whether one player can force
+         a win when the other three play together against them (paranoid search), using
+         alpha-beta over win/loss values: a player's node is cut off by its first winning move
+         and an opponent's node by its first refutation. Moves are ordered so that cut-offs come
+         early (going out first, then bigger combinations, then cheaper ones, passing last).
+         Positions are Zobrist-hashed and their results kept in a fixed-size lock-free
+         transposition table; every entry stores key ^ data next to data, so a torn write
+         between threads just reads as a miss. The solver is const apart from the table, so
+         search threads share one solver. Results depend only on the position, so the table
+         stays valid across moves and games.
+ATTRIBUTES:
+    - table: unique_ptr<Entry[]> (2^tableBits entries of 16 bytes; the default 1 MB stays in cache)
+    - tableMask: uint64_t
+METHODS:
+    + EndgameSolver(tableBits: int)
+    + solve(position: GameEngine, player: int, nodeLimit: long long, bestMove: Move*): Outcome
+    + solveMoves(position: GameEngine, legal: MoveList, nodeLimit: long long, wins: vector<char>&): bool
+    + countWins(engine: GameEngine, belief: BeliefModel, legal: MoveList, samples: int,
+                randomState: uint64_t&, wins: vector<int>&): int
+DATE: 2026-10-19
+*/
+
+class EndgameSolver {
+public:
+    enum Outcome { LOSS = 0, WIN = 1, UNKNOWN = 2 };
+
+    // Nodes one solve may visit before giving up
+    static const long long DEFAULT_NODE_LIMIT = 200000;
+
+    explicit EndgameSolver(int tableBits = 16);
+
+    // Whether player can force a win from position; UNKNOWN if nodeLimit ran out. On a win,
+    // bestMove (if given and player is to move) gets a winning move.
+    Outcome solve(const GameEngine& position, int player, long long nodeLimit = DEFAULT_NODE_LIMIT,
+                  Move* bestMove = nullptr) const;
+
+    // Solves every legal move for the player to move: wins[i] is nonzero when legal[i] forces a
+    // win. Returns false if nodeLimit (shared by all the moves) ran out.
+    bool solveMoves(const GameEngine& position, const MoveList& legal, long long nodeLimit,
+                    std::vector<char>& wins) const;
+
+    // Solves samples deals of the hidden cards drawn from belief and adds to wins[i] the number
+    // of deals in which legal[i] forces a win. Returns the number of deals solved in time.
+    int countWins(const GameEngine& engine, const BeliefModel& belief, const MoveList& legal, int samples,
+                  std::uint64_t& randomState, std::vector<int>& wins) const;
+
+private:
+    struct Entry {
+        std::atomic<std::uint64_t> check;  // Key ^ data
+        std::atomic<std::uint64_t> data;
+    };
+
+    // Per-call search state, so concurrent solves only share the table
+    struct Search {
+        int player;
+        long long nodes;
+        long long nodeLimit;
+        std::vector<MoveList> stack;  // One move list per ply, reserved up front
+    };
+
+    std::unique_ptr<Entry[]> table;
+    std::uint64_t tableMask;
+
+    Outcome search(const GameEngine& state, std::uint64_t hash, int depth, Search& context) const;
+    bool searchMoves(const GameEngine& state, const MoveList& legal, Search& context, std::vector<char>& wins) const;
+    bool probe(std::uint64_t hash, Outcome& outcome, CardMask& bestCards) const;
+    void store(std::uint64_t hash, Outcome outcome, CardMask bestCards) const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,152 @@
+#include "GameEngine.h"
+#include <stdexcept>
+
+namespace {
+
+// SplitMix64: small, fast and the same on every platform, so a seed always deals the same game
+inline std::uint64_t nextRandom(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+}  // namespace
+
+GameEngine::GameEngine() : trick{0, 0}, trickOwner(-1), currentPlayer(0), passes(0), firstMove(false),
+                           winner(-1), moveCount(0), playedCards(0), observer(nullptr) {
+    hands.fill(0);
+}
+
+void GameEngine::reset(std::uint64_t seed) {
+    std::uint8_t deck[NUM_CARDS];
+    for (int i = 0; i < NUM_CARDS; i++) {
+        deck[i] = static_cast<std::uint8_t>(i);
+    }
+    std::uint64_t state = seed;
+    for (int i = NUM_CARDS - 1; i > 0; i--) {
+        int j = static_cast<int>(nextRandom(state) % static_cast<std::uint64_t>(i + 1));
+        std::uint8_t card = deck[i];
+        deck[i] = deck[j];
+        deck[j] = card;
+    }
+
+    std::array<CardMask, 4> dealt = {0, 0, 0, 0};
+    for (int i = 0; i < NUM_CARDS; i++) {
+        dealt[i % NUM_PLAYERS] |= cardBit(deck[i]);
+    }
+
+    int first = 0;
+    while ((dealt[first] & cardBit(THREE_OF_DIAMONDS)) == 0) {
+        first++;
+    }
+    reset(dealt, first);
+}
+
+void GameEngine::reset(const std::array<CardMask, 4>& newHands, int firstPlayer, const Move& newTrick,
+                       int newTrickOwner) {
+    if (firstPlayer < 0 || firstPlayer >= NUM_PLAYERS) {
+        throw std::invalid_argument("First player must be between 0 and 3");
+    }
+    // Three passes hand the lead back to the trick's owner, so a played trick needs a real one
+    if (!newTrick.isPass() && (newTrickOwner < 0 || newTrickOwner >= NUM_PLAYERS)) {
+        throw std::invalid_argument("A played trick needs an owner between 0 and 3");
+    }
+    hands = newHands;
+    trick = newTrick;
+    trickOwner = newTrick.isPass() ? firstPlayer : newTrickOwner;
+    currentPlayer = firstPlayer;
+    passes = 0;
+    winner = -1;
+    moveCount = 0;
+
+    CardMask held = 0;
+    for (int player = 0; player < NUM_PLAYERS; player++) {
+        held |= hands[player];
+        if (hands[player] == 0) {
+            winner = player;
+        }
+    }
+    playedCards = FULL_DECK & ~held;
+    firstMove = playedCards == 0 && trick.isPass() && (hands[firstPlayer] & cardBit(THREE_OF_DIAMONDS)) != 0;
+
+    if (observer) {
+        observer->onReset(*this);
+    }
+}
+
+int GameEngine::legalMoves(MoveList& moves) const {
+    moves.clear();
+    if (isTerminal()) {
+        return 0;
+    }
+    CardMask required = firstMove ? cardBit(THREE_OF_DIAMONDS) : 0;
+    MoveGenerator::generate(hands[currentPlayer], trick, moves, required);
+    if (!trick.isPass()) {
+        moves.add(0, 0);
+    }
+    return moves.count;
+}
+
+bool GameEngine::isLegal(const Move& move) const {
+    if (isTerminal()) {
+        return false;
+    }
+    if (move.isPass()) {
+        return !trick.isPass();
+    }
+    if ((move.cards & ~hands[currentPlayer]) != 0 || move.key == 0) {
+        return false;
+    }
+    if (firstMove && (move.cards & cardBit(THREE_OF_DIAMONDS)) == 0) {
+        return false;
+    }
+    return move.beats(trick);
+}
+
+void GameEngine::apply(const Move& move) {
+    int player = currentPlayer;
+    moveCount++;
+
+    if (move.isPass()) {
+        passes++;
+        currentPlayer = (currentPlayer + 1) % NUM_PLAYERS;
+        if (passes == NUM_PLAYERS - 1) {
+            // Everyone else passed: the trick's owner leads anything
+            trick = Move{0, 0};
+            passes = 0;
+            currentPlayer = trickOwner;
+        }
+    } else {
+        hands[player] &= ~move.cards;
+        playedCards |= move.cards;
+        trick = move;
+        trickOwner = player;
+        passes = 0;
+        firstMove = false;
+        if (hands[player] == 0) {
+            winner = player;
+        }
+        currentPlayer = (currentPlayer + 1) % NUM_PLAYERS;
+    }
+
+    if (observer) {
+        observer->onMove(*this, player, move);
+        if (winner >= 0) {
+            observer->onGameOver(*this, winner);
+        }
+    }
+}
+
+int GameEngine::play(Agent* const* agents) {
+    MoveList moves;
+    while (!isTerminal()) {
+        legalMoves(moves);
+        Move move = agents[currentPlayer]->chooseMove(*this, moves);
+        for (int seat = 0; seat < NUM_PLAYERS; seat++) {
+            agents[seat]->observeMove(*this, currentPlayer, move);
+        }
+        apply(move);
+    }
+    return winner;
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#ifndef GAMEENGINE_H
+#define GAMEENGINE_H
+
+#include "Agent.h"
+#include "CardMask.h"
+#include "MoveGenerator.h"
+#include <array>
+#include <cstdint>
+
+/*
+CLASS: GameObserver
+PURPOSE: Optional listener for a GameEngine; the engine itself does no I/O
+METHODS:
+    + onReset(engine: GameEngine): void
+    + onMove(engine: GameEngine, player: int, move: Move): void
+    + onGameOver(engine: GameEngine, winner: int): void
+DATE: 2026-10-19
+*/
+
+class GameObserver {
+public:
+    virtual ~GameObserver() {}
+    virtual void onReset(const GameEngine& /*engine*/) {}
+    // Called after the move has been applied
+    virtual void onMove(const GameEngine& /*engine*/, int /*player*/, const Move& /*move*/) {}
+    virtual void onGameOver(const GameEngine& /*engine*/, int /*winner*/) {}
+};
+
+/*
+CLASS: GameEngine
+PURPOSE: I/O-free Big 2 rules for four players on card masks. The holder of the 3 of diamonds leads
+         it first; a trick ends when the other three pass in a row and its owner leads again; the
+         first player to empty their hand wins. The state is plain data, so copying an engine is
+         cheap (search players copy it to simulate).
+ATTRIBUTES:
+    - hands: array<CardMask, 4>
+    - trick: Move (cards to beat; a pass when the current player leads)
+    - trickOwner: int
+    - currentPlayer: int
+    - passes: int (consecutive passes on the trick)
+    - firstMove: bool
+    - winner: int (-1 until the game ends)
+    - moveCount: int
+    - playedCards: CardMask
+    - observer: GameObserver*
+METHODS:
+    + reset(seed: uint64_t): void
+    + reset(hands: array<CardMask, 4>, firstPlayer: int, trick: Move, trickOwner: int): void
+    + legalMoves(moves: MoveList&): int
+    + setHands(hands: array<CardMask, 4>): void
+    + apply(move: Move): void
+    + isLegal(move: Move): bool
+    + isTerminal(): bool
+    + play(agents: Agent* const*): int
+    + getters for the state, setObserver(observer: GameObserver*): void
+DATE: 2026-10-19
+*/
+
+class GameEngine {
+public:
+    static const int NUM_PLAYERS = 4;
+
+    GameEngine();
+
+    // Shuffles and deals from the seed; the same seed always deals the same hands
+    void reset(std::uint64_t seed);
+
+    // Starts from a given position, e.g. a sampled deal or an endgame. trick is a pass when
+    // firstPlayer leads, otherwise trickOwner (0-3) is the player who played it; throws
+    // std::invalid_argument for a bad player. The 3 of diamonds must open only when no card has
+    // been played yet.
+    void reset(const std::array<CardMask, 4>& hands, int firstPlayer, const Move& trick = Move{0, 0},
+               int trickOwner = -1);
+
+    // Swaps in other hands with the same sizes, keeping the turn and trick. Search players use it
+    // to deal the cards they cannot see.
+    void setHands(const std::array<CardMask, 4>& newHands) { hands = newHands; }
+
+    // Replaces moves with the current player's legal moves (pass included when following)
+    int legalMoves(MoveList& moves) const;
+
+    // Plays a legal move for the current player; apply does not check legality
+    void apply(const Move& move);
+    bool isLegal(const Move& move) const;
+
+    bool isTerminal() const { return winner >= 0; }
+
+    // Plays to the end, asking agents[seat] for each move and showing it to every agent before it
+    // is applied; returns the winner
+    int play(Agent* const* agents);
+
+    int getCurrentPlayer() const { return currentPlayer; }
+    int getWinner() const { return winner; }
+    CardMask getHand(int player) const { return hands[player]; }
+    int getCardsLeft(int player) const { return countCards(hands[player]); }
+    const Move& getTrick() const { return trick; }
+    int getTrickOwner() const { return trickOwner; }
+    int getPassCount() const { return passes; }
+    bool isFirstMove() const { return firstMove; }
+    int getMoveCount() const { return moveCount; }
+    CardMask getPlayedCards() const { return playedCards; }
+    void setObserver(GameObserver* gameObserver) { observer = gameObserver; }
+
+private:
+    std::array<CardMask, 4> hands;
+    Move trick;
+    int trickOwner;
+    int currentPlayer;
+    int passes;
+    bool firstMove;
+    int winner;
+    int moveCount;
+    CardMask playedCards;
+    GameObserver* observer;
+};
+
+#endif
\ No newline at end of file
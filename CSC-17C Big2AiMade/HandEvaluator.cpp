@@ -0,0 +1,105 @@
+#include "HandEvaluator.h"
+#include <array>
+
+namespace {
+
+// Combination type by card count and number of distinct values. Five cards of two values are a
+// full house unless one value has all four; five distinct values may be a straight and/or flush.
+const ComboType SHAPES[6][6] = {
+    {PASS, PASS, PASS, PASS, PASS, PASS},
+    {PASS, SINGLE, PASS, PASS, PASS, PASS},
+    {PASS, PAIR, PASS, PASS, PASS, PASS},
+    {PASS, TRIPLE, PASS, PASS, PASS, PASS},
+    {PASS, PASS, PASS, PASS, PASS, PASS},
+    {PASS, PASS, FULL_HOUSE, PASS, PASS, STRAIGHT}
+};
+
+// STRAIGHTS[v] is 1 when the 13-bit value mask v is five consecutive values
+const std::array<unsigned char, 1 << NUM_RANKS> STRAIGHTS = [] {
+    std::array<unsigned char, 1 << NUM_RANKS> table = {};
+    for (int low = 0; low + 5 <= NUM_RANKS; low++) {
+        table[0x1F << low] = 1;
+    }
+    return table;
+}();
+
+// Gathers the bits at positions 0, 4, 8, ..., 48 into a 13-bit value mask
+inline unsigned compressRanks(CardMask spread) {
+    spread = (spread | (spread >> 3)) & 0x0303030303030303ULL;
+    spread = (spread | (spread >> 6)) & 0x000F000F000F000FULL;
+    spread = (spread | (spread >> 12)) & 0x000000FF000000FFULL;
+    spread = (spread | (spread >> 24)) & 0xFFFFULL;
+    return static_cast<unsigned>(spread);
+}
+
+}  // namespace
+
+Move HandEvaluator::evaluate(CardMask cards) {
+    Move invalid = {0, 0};
+    int size = countCards(cards);
+    if (size == 0 || size > 5 || (cards & ~FULL_DECK) != 0) {
+        return invalid;
+    }
+
+    // Each nibble of counts is the number of cards of that value (0-4)
+    CardMask counts = cards - ((cards >> 1) & 0x5555555555555555ULL);
+    counts = (counts & 0x3333333333333333ULL) + ((counts >> 2) & 0x3333333333333333ULL);
+    unsigned ranks = compressRanks((counts | (counts >> 1) | (counts >> 2)) & SUIT_PATTERN);
+
+    ComboType type = SHAPES[size][countCards(ranks)];
+    std::uint32_t strength = 0;
+    switch (type) {
+        case SINGLE:
+            strength = lowestCard(cards);
+            break;
+        case PAIR:
+            strength = highestCard(cards);
+            break;
+        case TRIPLE:
+            strength = indexValue(lowestCard(cards));
+            break;
+        case FULL_HOUSE: {
+            CardMask fours = (counts >> 2) & SUIT_PATTERN;
+            if (fours != 0) {
+                type = FOUR_OF_A_KIND;
+                strength = indexValue(lowestCard(fours));
+            } else {
+                strength = indexValue(lowestCard(counts & (counts >> 1) & SUIT_PATTERN));
+            }
+            break;
+        }
+        case STRAIGHT: {
+            int suit = indexSuit(lowestCard(cards));
+            bool flush = (cards & ~suitMask(suit)) == 0;
+            if (STRAIGHTS[ranks]) {
+                type = flush ? STRAIGHT_FLUSH : STRAIGHT;
+                strength = highestCard(cards);
+            } else if (flush) {
+                type = FLUSH;
+                strength = (ranks << 2) | suit;
+            } else {
+                return invalid;
+            }
+            break;
+        }
+        default:
+            return invalid;
+    }
+
+    Move move = {cards, makeKey(type, strength)};
+    return move;
+}
+
+Move HandEvaluator::evaluate(Card* const* cards, int count) {
+    CardMask mask = 0;
+    for (int i = 0; i < count; i++) {
+        if (!cards[i]) {
+            return Move{0, 0};
+        }
+        mask |= cards[i]->getMask();
+    }
+    if (countCards(mask) != count) {
+        return Move{0, 0};
+    }
+    return evaluate(mask);
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef HANDEVALUATOR_H
+#define HANDEVALUATOR_H
+
+#include "Card.h"
+#include "MoveGenerator.h"
+
+/*
+CLASS: HandEvaluator
+PURPOSE: Classifies any set of 1-5 cards as a Big 2 combination and gives its strength key (see Move),
+         so "does this beat that" is one integer comparison. Per-value card counts come from a
+         branch-free nibble popcount of the mask; the shape (type for a card count and number of
+         distinct values) and the straights over a 13-bit value mask are precomputed tables.
+METHODS:
+    + evaluate(cards: CardMask): Move
+    + evaluate(cards: Card* const*, count: int): Move
+    + isValid(cards: CardMask): bool
+DATE: 2026-10-19
+*/
+
+class HandEvaluator {
+public:
+    // The combination these cards form, or a pass (no cards, key 0) when they form none
+    static Move evaluate(CardMask cards);
+
+    // As above for Card objects; a card listed twice makes the set invalid
+    static Move evaluate(Card* const* cards, int count);
+
+    static bool isValid(CardMask cards) { return evaluate(cards).key != 0; }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,344 @@
+#include "MCTSPlayer.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace {
+
+// Exploration constant for UCB
+const double EXPLORATION = 0.7;
+
+// Passes the default pass confidence counts for before an opponent's own passes are seen
+const double PRIOR_PASSES = 4.0;
+
+// Chance that a rollout move is uniformly random instead of greedy
+const int ROLLOUT_RANDOM_PERCENT = 10;
+
+// SplitMix64 generator; cheap to seed once per search thread
+struct FastRandom {
+    std::uint64_t state;
+
+    explicit FastRandom(std::uint64_t seed) : state(seed) {}
+
+    std::uint64_t next() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform in [0, bound)
+    int below(int bound) {
+        return static_cast<int>(((next() >> 32) * static_cast<std::uint64_t>(bound)) >> 32);
+    }
+};
+
+// Greedy rollout policy: lead the largest combination holding the lowest card, otherwise beat the
+// trick as cheaply as possible; sometimes play a random legal move instead
+const Move& rolloutMove(const GameEngine& state, const MoveList& moves, FastRandom& random) {
+    if (random.below(100) < ROLLOUT_RANDOM_PERCENT) {
+        return moves[random.below(moves.count)];
+    }
+
+    const Move* choice = nullptr;
+    if (state.getTrick().isPass()) {
+        CardMask lowest = cardBit(lowestCard(state.getHand(state.getCurrentPlayer())));
+        for (const Move& move : moves) {
+            if ((move.cards & lowest) &&
+                (!choice || move.size() > choice->size() ||
+                 (move.size() == choice->size() && move.key < choice->key))) {
+                choice = &move;
+            }
+        }
+    } else {
+        for (const Move& move : moves) {
+            if (!move.isPass() && (!choice || move.key < choice->key)) {
+                choice = &move;
+            }
+        }
+    }
+    return choice ? *choice : moves[moves.count - 1];  // The pass is added last
+}
+
+}  // namespace
+
+MCTSPlayer::MCTSPlayer(int timeLimit, int playouts, int threadCount, int endgame)
+    : timeLimitMs(timeLimit), playoutLimit(playouts), threads(threadCount), endgameCards(endgame), seed(0),
+      decisions(0), lastPlayouts(0), seat(0), beliefStale(true) {
+    for (int offset = 0; offset < GameEngine::NUM_PLAYERS; offset++) {
+        passesSeen[offset] = 0;
+        passesBroken[offset] = 0;
+    }
+    if (timeLimitMs <= 0 && playoutLimit <= 0) {
+        timeLimitMs = 50;
+    }
+    if (threads <= 0) {
+        threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+}
+
+void MCTSPlayer::newGame(int gameSeat, std::uint64_t gameSeed) {
+    seat = gameSeat;
+    seed = gameSeed ^ (static_cast<std::uint64_t>(seat) << 56);
+    decisions = 0;
+    beliefStale = true;
+    for (std::vector<CardMask>& passes : openPasses) {
+        passes.clear();
+    }
+}
+
+void MCTSPlayer::updateBelief(const GameEngine& engine) {
+    if (beliefStale || !belief.isCurrent(engine)) {
+        belief.reset(engine, seat);
+        beliefStale = false;
+    }
+}
+
+double MCTSPlayer::passConfidence(int player) const {
+    int offset = (player - seat + GameEngine::NUM_PLAYERS) % GameEngine::NUM_PLAYERS;
+    double honest = BeliefModel::DEFAULT_PASS_CONFIDENCE * PRIOR_PASSES + passesSeen[offset] - passesBroken[offset];
+    return honest / (PRIOR_PASSES + passesSeen[offset]);
+}
+
+void MCTSPlayer::learnPassConfidence(const GameEngine& engine, int player, const Move& move) {
+    if (player == seat) {
+        return;
+    }
+    // Seats rotate between games; the offset from ours follows the same opponent
+    int offset = (player - seat + GameEngine::NUM_PLAYERS) % GameEngine::NUM_PLAYERS;
+    std::vector<CardMask>& passes = openPasses[offset];
+    if (!move.isPass()) {
+        for (std::size_t i = 0; i < passes.size(); ) {
+            if (passes[i] & move.cards) {
+                passesBroken[offset]++;
+                passes[i] = passes.back();
+                passes.pop_back();
+            } else {
+                i++;
+            }
+        }
+        return;
+    }
+
+    // Only a single can be shown beaten by one later card
+    const Move& trick = engine.getTrick();
+    if (!trick.isPass() && trick.getType() == SINGLE) {
+        CardMask above = cardsAbove(highestCard(trick.cards)) & belief.getUnseen();
+        if (above != 0) {
+            passesSeen[offset]++;
+            passes.push_back(above);
+        }
+    }
+    belief.setPassConfidence(player, passConfidence(player));
+}
+
+void MCTSPlayer::observeMove(const GameEngine& engine, int player, const Move& move) {
+    updateBelief(engine);
+    learnPassConfidence(engine, player, move);
+    belief.observe(engine, player, move);
+}
+
+Move MCTSPlayer::chooseMove(const GameEngine& engine, const MoveList& legal) {
+    if (legal.count == 1) {
+        return legal[0];
+    }
+    decisions++;
+    seat = engine.getCurrentPlayer();
+    updateBelief(engine);
+    lastPlayouts = 0;
+
+    Move endgame;
+    if (solveEndgame(engine, legal, endgame)) {
+        return endgame;
+    }
+
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeLimitMs);
+    long long perThread = playoutLimit > 0 ? (playoutLimit + threads - 1) / threads : 0;
+
+    // Root parallelism: independent trees, merged by root visit counts
+    std::vector<SearchResult> results(threads);
+    std::vector<std::thread> workers;
+    for (int thread = 0; thread < threads; thread++) {
+        std::uint64_t searchSeed = FastRandom(seed ^ (decisions << 20) ^ static_cast<std::uint64_t>(thread)).next();
+        if (thread == 0) {
+            continue;
+        }
+        workers.emplace_back([this, &engine, &results, thread, searchSeed, perThread, deadline]() {
+            results[thread] = search(engine, searchSeed, perThread, deadline);
+        });
+    }
+    results[0] = search(engine, FastRandom(seed ^ (decisions << 20)).next(), perThread, deadline);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    lastPlayouts = 0;
+    for (const SearchResult& result : results) {
+        lastPlayouts += result.playouts;
+    }
+
+    const Move* best = &legal[0];
+    long long bestVisits = -1;
+    for (const Move& move : legal) {
+        long long visits = 0;
+        for (const SearchResult& result : results) {
+            for (std::size_t i = 0; i < result.moves.size(); i++) {
+                if (result.moves[i].cards == move.cards) {
+                    visits += result.visits[i];
+                }
+            }
+        }
+        if (visits > bestVisits) {
+            best = &move;
+            bestVisits = visits;
+        }
+    }
+    return *best;
+}
+
+bool MCTSPlayer::solveEndgame(const GameEngine& engine, const MoveList& legal, Move& choice) {
+    int cardsLeft = 0;
+    for (int player = 0; player < GameEngine::NUM_PLAYERS; player++) {
+        cardsLeft += engine.getCardsLeft(player);
+    }
+    if (endgameCards <= 0 || cardsLeft > endgameCards) {
+        return false;
+    }
+    if (!solver) {
+        solver.reset(new EndgameSolver());
+    }
+
+    // Each thread solves its share of the deals; the transposition table is shared
+    std::vector<std::vector<int>> wins(threads);
+    auto solveShare = [this, &engine, &legal, &wins](int thread) {
+        int samples = ENDGAME_SAMPLES / threads + (thread < ENDGAME_SAMPLES % threads ? 1 : 0);
+        std::uint64_t randomState =
+            FastRandom(seed ^ (decisions << 20) ^ static_cast<std::uint64_t>(thread)).next();
+        wins[thread].assign(legal.count, 0);
+        solver->countWins(engine, belief, legal, samples, randomState, wins[thread]);
+    };
+    std::vector<std::thread> workers;
+    for (int thread = 1; thread < threads; thread++) {
+        workers.emplace_back(solveShare, thread);
+    }
+    solveShare(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    int best = -1;
+    int bestWins = 0;
+    for (int i = 0; i < legal.count; i++) {
+        int total = 0;
+        for (const std::vector<int>& threadWins : wins) {
+            total += threadWins[i];
+        }
+        if (total > bestWins) {
+            best = i;
+            bestWins = total;
+        }
+    }
+    if (best < 0) {
+        return false;
+    }
+    choice = legal[best];
+    return true;
+}
+
+MCTSPlayer::SearchResult MCTSPlayer::search(const GameEngine& engine, std::uint64_t searchSeed, long long playouts,
+                                            std::chrono::steady_clock::time_point deadline) const {
+    FastRandom random(searchSeed);
+    std::vector<Node> nodes;
+    nodes.reserve(4096);
+    nodes.push_back(Node{Move{0, 0}, -1, -1, 0, 0, 0.0, std::vector<int>()});
+
+    MoveList moves;
+    std::array<CardMask, 4> hands;
+    long long iteration = 0;
+    for (;; iteration++) {
+        if (playouts > 0 && iteration >= playouts) {
+            break;
+        }
+        if (timeLimitMs > 0 && (iteration & 15) == 0 && std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+
+        GameEngine state = engine;
+        state.setObserver(nullptr);
+        belief.sample(hands, random.state);
+        state.setHands(hands);
+
+        // Selection and expansion over the moves legal in this deal
+        int node = 0;
+        while (!state.isTerminal()) {
+            state.legalMoves(moves);
+            int player = state.getCurrentPlayer();
+            int best = -1;
+            double bestScore = -1;
+            const Move* untried = nullptr;
+            int untriedCount = 0;
+
+            for (const Move& move : moves) {
+                const std::vector<int>& children = nodes[node].children;
+                std::vector<int>::const_iterator found = std::lower_bound(
+                    children.begin(), children.end(), move.cards,
+                    [&nodes](int child, CardMask cards) { return nodes[child].move.cards < cards; });
+                if (found == children.end() || nodes[*found].move.cards != move.cards) {
+                    // Reservoir sample one untried move
+                    if (random.below(++untriedCount) == 0) {
+                        untried = &move;
+                    }
+                    continue;
+                }
+                Node& child = nodes[*found];
+                child.available++;
+                double logAvailable = std::log(static_cast<double>(child.available));
+                double score = child.reward / child.visits + EXPLORATION * std::sqrt(logAvailable / child.visits);
+                if (score > bestScore) {
+                    bestScore = score;
+                    best = *found;
+                }
+            }
+
+            if (untried) {
+                int child = static_cast<int>(nodes.size());
+                nodes.push_back(Node{*untried, player, node, 0, 1, 0.0, std::vector<int>()});
+                std::vector<int>& children = nodes[node].children;
+                CardMask cards = untried->cards;
+                children.insert(std::lower_bound(children.begin(), children.end(), cards,
+                                                 [&nodes](int other, CardMask key) {
+                                                     return nodes[other].move.cards < key;
+                                                 }),
+                                child);
+                state.apply(*untried);
+                node = child;
+                break;
+            }
+            state.apply(nodes[best].move);
+            node = best;
+        }
+
+        // Rollout
+        while (!state.isTerminal()) {
+            state.legalMoves(moves);
+            state.apply(rolloutMove(state, moves, random));
+        }
+
+        // Backpropagation: each node scores the game for the player who made its move
+        int winner = state.getWinner();
+        for (; node > 0; node = nodes[node].parent) {
+            nodes[node].visits++;
+            nodes[node].reward += nodes[node].player == winner ? 1.0 : 0.0;
+        }
+        nodes[0].visits++;
+    }
+
+    SearchResult result;
+    result.playouts = iteration;
+    for (int child : nodes[0].children) {
+        result.moves.push_back(nodes[child].move);
+        result.visits.push_back(nodes[child].visits);
+    }
+    return result;
+}
\ No newline at end of file
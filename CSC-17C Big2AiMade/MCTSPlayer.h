@@ -0,0 +1,112 @@
+#ifndef MCTSPLAYER_H
+#define MCTSPLAYER_H
+
+#include "Agent.h"
+#include "BeliefModel.h"
+#include "EndgameSolver.h"
+#include "GameEngine.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/*
+CLASS: MCTSPlayer
+PURPOSE: Information set Monte Carlo tree search player. Every iteration deals the cards it cannot
+         see to the opponents from its BeliefModel (a determinization with the right hand sizes,
+         weighted by their passes), walks one shared tree choosing among the moves legal in that
+         deal (UCB with availability counts), and finishes the game with a fast greedy rollout.
+         How far it trusts a pass is learned per opponent, by seat offset, across games: a pass
+         on a single counts against that opponent once it plays a card that beat the single.
+         Root-parallel: each thread grows its own tree and the root visit counts are summed to
+         pick the move. Once at most endgameCards cards are left in all hands, the threads
+         instead solve belief-weighted deals exactly with one shared EndgameSolver and it plays
+         the move that wins the most of them, searching as usual when none wins. It only reads
+         its own hand and public information from the engine.
+INHERITS: Agent
+ATTRIBUTES:
+    - timeLimitMs: int (wall-clock budget per move, 0 for none)
+    - playoutLimit: int (playouts per move over all threads, 0 for none)
+    - threads: int
+    - endgameCards: int (0 turns the endgame solver off)
+    - solver: unique_ptr<EndgameSolver> (created on first use)
+    - seed: uint64_t (from newGame; with a playout budget, games replay exactly)
+    - seat: int
+    - belief: BeliefModel (updated by observeMove)
+    - beliefStale: bool (set by newGame; the next call restarts the belief)
+    - passesSeen, passesBroken: long long[4] (single passes by seat offset, and those later beaten)
+    - openPasses: vector<CardMask>[4] (cards above each single passed on this game, by seat offset)
+    - decisions: uint64_t
+    - lastPlayouts: long long
+METHODS:
+    + MCTSPlayer(timeLimitMs: int, playoutLimit: int, threads: int, endgameCards: int)
+    + newGame(seat: int, seed: uint64_t): void
+    + observeMove(engine: GameEngine, player: int, move: Move): void
+    + chooseMove(engine: GameEngine, legal: MoveList): Move
+    + getLastPlayouts(): long long
+DATE: 2026-10-19
+*/
+
+class MCTSPlayer : public Agent {
+public:
+    // Deals of the hidden cards solved per endgame move, over all threads
+    static const int ENDGAME_SAMPLES = 32;
+
+    // With neither limit set, each move gets 50 ms
+    MCTSPlayer(int timeLimitMs = 50, int playoutLimit = 0, int threads = 1, int endgameCards = 20);
+
+    void newGame(int seat, std::uint64_t seed) override;
+    void observeMove(const GameEngine& engine, int player, const Move& move) override;
+    Move chooseMove(const GameEngine& engine, const MoveList& legal) override;
+
+    // Playouts summed over all threads for the last searched move
+    long long getLastPlayouts() const { return lastPlayouts; }
+
+private:
+    struct Node {
+        Move move;           // Move that led here
+        int player;          // Player who made it
+        int parent;
+        int visits;
+        int available;       // Times the move was legal when its parent was visited
+        double reward;       // Total reward for player
+        std::vector<int> children;  // Sorted by move cards
+    };
+
+    // Root visit counts from one thread's search
+    struct SearchResult {
+        std::vector<Move> moves;
+        std::vector<long long> visits;
+        long long playouts;
+    };
+
+    int timeLimitMs;
+    int playoutLimit;
+    int threads;
+    int endgameCards;
+    std::unique_ptr<EndgameSolver> solver;
+    std::uint64_t seed;
+    std::uint64_t decisions;
+    long long lastPlayouts;
+    int seat;
+    BeliefModel belief;
+    bool beliefStale;
+    long long passesSeen[GameEngine::NUM_PLAYERS];
+    long long passesBroken[GameEngine::NUM_PLAYERS];
+    std::vector<CardMask> openPasses[GameEngine::NUM_PLAYERS];
+
+    // Restarts the belief when a new game began or moves went unobserved
+    void updateBelief(const GameEngine& engine);
+    // Counts player's passes on singles and the ones move shows it could have beaten
+    void learnPassConfidence(const GameEngine& engine, int player, const Move& move);
+    // Share of player's single passes not yet beaten, starting from the belief's default
+    double passConfidence(int player) const;
+    // Picks the move that wins the most solved deals; false outside the endgame or if none wins
+    bool solveEndgame(const GameEngine& engine, const MoveList& legal, Move& choice);
+    // Grows one tree until playouts (if > 0) or the deadline (if timed) runs out
+    SearchResult search(const GameEngine& engine, std::uint64_t searchSeed, long long playouts,
+                        std::chrono::steady_clock::time_point deadline) const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include "MoveGenerator.h"
+
+namespace {
+
+// Appends moves that beat the trick and contain the required cards
+struct MoveSink {
+    MoveList& moves;
+    std::uint32_t minKey;
+    CardMask required;
+    int added;
+
+    void add(CardMask cards, std::uint32_t key) {
+        if (key > minKey && (cards & required) == required) {
+            moves.add(cards, key);
+            added++;
+        }
+    }
+};
+
+// The pairs and triples available in each value, found once per generate call
+struct RankGroups {
+    CardMask pairs[NUM_RANKS][6];
+    int pairCount[NUM_RANKS];
+    CardMask triples[NUM_RANKS][4];
+    int tripleCount[NUM_RANKS];
+    int present;  // Bit v - 3 is set when the hand holds a card of value v
+
+    explicit RankGroups(CardMask hand) : present(0) {
+        for (int rank = 0; rank < NUM_RANKS; rank++) {
+            CardMask cards = hand & rankMask(rank + LOWEST_VALUE);
+            pairCount[rank] = 0;
+            tripleCount[rank] = 0;
+            if (cards == 0) {
+                continue;
+            }
+            present |= 1 << rank;
+
+            for (CardMask first = cards; first != 0; first &= first - 1) {
+                CardMask low = first & (~first + 1);
+                for (CardMask second = first & (first - 1); second != 0; second &= second - 1) {
+                    pairs[rank][pairCount[rank]++] = low | (second & (~second + 1));
+                }
+            }
+
+            int count = countCards(cards);
+            if (count == 3) {
+                triples[rank][tripleCount[rank]++] = cards;
+            } else if (count == 4) {
+                for (CardMask left = cards; left != 0; left &= left - 1) {
+                    triples[rank][tripleCount[rank]++] = cards & ~(left & (~left + 1));
+                }
+            }
+        }
+    }
+};
+
+void addSingles(CardMask hand, const Move& trick, MoveSink& sink) {
+    CardMask cards = trick.isPass() ? hand : hand & cardsAbove(static_cast<int>(trick.key & 0xFFFFFF));
+    while (cards != 0) {
+        int index = popLowestCard(cards);
+        sink.add(cardBit(index), makeKey(SINGLE, index));
+    }
+}
+
+void addPairs(const RankGroups& groups, MoveSink& sink) {
+    for (int rank = 0; rank < NUM_RANKS; rank++) {
+        for (int i = 0; i < groups.pairCount[rank]; i++) {
+            CardMask cards = groups.pairs[rank][i];
+            sink.add(cards, makeKey(PAIR, highestCard(cards)));
+        }
+    }
+}
+
+void addTriples(const RankGroups& groups, MoveSink& sink) {
+    for (int rank = 0; rank < NUM_RANKS; rank++) {
+        for (int i = 0; i < groups.tripleCount[rank]; i++) {
+            sink.add(groups.triples[rank][i], makeKey(TRIPLE, rank + LOWEST_VALUE));
+        }
+    }
+}
+
+// Straights and straight flushes: one card from each of five consecutive values
+void addStraights(CardMask hand, const RankGroups& groups, bool flushOnly, MoveSink& sink) {
+    for (int low = 0; low + 5 <= NUM_RANKS; low++) {
+        if (((groups.present >> low) & 0x1F) != 0x1F) {
+            continue;
+        }
+
+        // Odometer over the cards of each value; slot 0 turns fastest
+        CardMask slots[5];
+        CardMask picks[5];
+        for (int i = 0; i < 5; i++) {
+            slots[i] = hand & rankMask(low + i + LOWEST_VALUE);
+            picks[i] = slots[i] & (~slots[i] + 1);
+        }
+        while (true) {
+            CardMask cards = picks[0] | picks[1] | picks[2] | picks[3] | picks[4];
+            int top = highestCard(cards);
+            bool flush = (cards & suitMask(indexSuit(top))) == cards;
+            if (flush) {
+                sink.add(cards, makeKey(STRAIGHT_FLUSH, top));
+            } else if (!flushOnly) {
+                sink.add(cards, makeKey(STRAIGHT, top));
+            }
+
+            int slot = 0;
+            for (; slot < 5; slot++) {
+                CardMask higher = slots[slot] & ~((picks[slot] << 1) - 1);
+                if (higher != 0) {
+                    picks[slot] = higher & (~higher + 1);
+                    break;
+                }
+                picks[slot] = slots[slot] & (~slots[slot] + 1);
+            }
+            if (slot == 5) {
+                break;
+            }
+        }
+    }
+}
+
+// Five cards of one suit that are not also a straight
+void addFlushes(CardMask hand, MoveSink& sink) {
+    for (int suit = 0; suit < NUM_SUITS; suit++) {
+        CardMask cards = hand & suitMask(suit);
+        int count = countCards(cards);
+        if (count < 5) {
+            continue;
+        }
+
+        // Ranks in ascending order; within one suit index order is value order
+        int ranks[MAX_HAND_SIZE];
+        CardMask bits[MAX_HAND_SIZE];
+        for (int i = 0; i < count; i++) {
+            int index = popLowestCard(cards);
+            ranks[i] = indexValue(index) - LOWEST_VALUE;
+            bits[i] = cardBit(index);
+        }
+
+        for (int a = 0; a < count; a++) {
+            for (int b = a + 1; b < count; b++) {
+                for (int c = b + 1; c < count; c++) {
+                    for (int d = c + 1; d < count; d++) {
+                        for (int e = d + 1; e < count; e++) {
+                            if (ranks[e] - ranks[a] == 4) {
+                                continue;  // Straight flush, generated with the straights
+                            }
+                            std::uint32_t rankBits = (1u << ranks[a]) | (1u << ranks[b]) | (1u << ranks[c]) |
+                                                     (1u << ranks[d]) | (1u << ranks[e]);
+                            sink.add(bits[a] | bits[b] | bits[c] | bits[d] | bits[e],
+                                     makeKey(FLUSH, (rankBits << 2) | suit));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void addFullHouses(const RankGroups& groups, MoveSink& sink) {
+    for (int three = 0; three < NUM_RANKS; three++) {
+        for (int i = 0; i < groups.tripleCount[three]; i++) {
+            for (int two = 0; two < NUM_RANKS; two++) {
+                if (two == three) {
+                    continue;
+                }
+                for (int j = 0; j < groups.pairCount[two]; j++) {
+                    sink.add(groups.triples[three][i] | groups.pairs[two][j],
+                             makeKey(FULL_HOUSE, three + LOWEST_VALUE));
+                }
+            }
+        }
+    }
+}
+
+void addFourOfAKinds(CardMask hand, MoveSink& sink) {
+    for (int value = LOWEST_VALUE; value <= HIGHEST_VALUE; value++) {
+        CardMask four = rankMask(value);
+        if ((hand & four) != four) {
+            continue;
+        }
+        for (CardMask kickers = hand & ~four; kickers != 0; kickers &= kickers - 1) {
+            sink.add(four | (kickers & (~kickers + 1)), makeKey(FOUR_OF_A_KIND, value));
+        }
+    }
+}
+
+}  // namespace
+
+int MoveGenerator::generate(CardMask hand, const Move& trick, MoveList& moves, CardMask required) {
+    MoveSink sink = {moves, trick.isPass() ? 0u : trick.key, required, 0};
+    if ((hand & required) != required) {
+        return 0;
+    }
+
+    int size = trick.size();
+    if (size == 4 || size > 5) {
+        return 0;
+    }
+    if (size == 1 || size == 0) {
+        addSingles(hand, trick, sink);
+        if (size == 1) {
+            return sink.added;
+        }
+    }
+
+    RankGroups groups(hand);
+    if (size == 2 || size == 0) {
+        addPairs(groups, sink);
+    }
+    if (size == 3 || size == 0) {
+        addTriples(groups, sink);
+    }
+    if ((size == 5 || size == 0) && countCards(hand) >= 5) {
+        // Skip whole categories the trick already outranks
+        ComboType lowest = size == 0 ? STRAIGHT : trick.getType();
+        addStraights(hand, groups, lowest > STRAIGHT, sink);
+        if (lowest <= FLUSH) {
+            addFlushes(hand, sink);
+        }
+        if (lowest <= FULL_HOUSE) {
+            addFullHouses(groups, sink);
+        }
+        if (lowest <= FOUR_OF_A_KIND) {
+            addFourOfAKinds(hand, sink);
+        }
+    }
+    return sink.added;
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#ifndef MOVEGENERATOR_H
+#define MOVEGENERATOR_H
+
+#include "CardMask.h"
+#include <cstdint>
+
+/*
+ENUM: ComboType
+PURPOSE: Kind of combination a move plays. Five-card hands are numbered in Big 2 order, so a
+         higher type always beats a lower one of the same size.
+DATE: 2026-10-19
+*/
+
+enum ComboType {
+    PASS = 0,
+    SINGLE = 1,
+    PAIR = 2,
+    TRIPLE = 3,
+    STRAIGHT = 4,
+    FLUSH = 5,
+    FULL_HOUSE = 6,
+    FOUR_OF_A_KIND = 7,
+    STRAIGHT_FLUSH = 8
+};
+
+/*
+STRUCT: Move
+PURPOSE: A set of cards played together and its strength key. The key is (type << 24) | strength,
+         so two moves of the same size compare with one integer comparison. Strength is:
+         single - card index; pair - higher card index; triple, full house, four of a kind -
+         value of the three or four; straight, straight flush - top card index; flush - 13-bit
+         value mask (highest card first) shifted left 2, plus the suit. A pass has no cards and
+         key 0.
+ATTRIBUTES:
+    - cards: CardMask
+    - key: uint32_t
+METHODS:
+    + getType(): ComboType
+    + size(): int
+    + isPass(): bool
+    + beats(trick: Move): bool
+DATE: 2026-10-19
+*/
+
+struct Move {
+    CardMask cards;
+    std::uint32_t key;
+
+    ComboType getType() const { return static_cast<ComboType>(key >> 24); }
+    int size() const { return countCards(cards); }
+    bool isPass() const { return cards == 0; }
+
+    // True when this move may be played on the trick (an empty trick means a new lead)
+    bool beats(const Move& trick) const {
+        return !isPass() && (trick.isPass() || (size() == trick.size() && key > trick.key));
+    }
+};
+
+inline std::uint32_t makeKey(ComboType type, std::uint32_t strength) {
+    return (static_cast<std::uint32_t>(type) << 24) | strength;
+}
+
+const int MAX_HAND_SIZE = 13;
+
+// Every move is a distinct 1, 2, 3 or 5 card subset of a hand of at most 13 cards:
+// C(13,1) + C(13,2) + C(13,3) + C(13,5) = 13 + 78 + 286 + 1287, plus one pass
+const int MAX_MOVES = 1665;
+
+/*
+STRUCT: MoveList
+PURPOSE: Fixed-capacity move buffer, so generating moves never allocates
+ATTRIBUTES:
+    - moves: Move[MAX_MOVES]
+    - count: int
+DATE: 2026-10-19
+*/
+
+struct MoveList {
+    Move moves[MAX_MOVES];
+    int count;
+
+    MoveList() : count(0) {}
+    void clear() { count = 0; }
+    void add(CardMask cards, std::uint32_t key) {
+        moves[count].cards = cards;
+        moves[count].key = key;
+        count++;
+    }
+    const Move& operator[](int i) const { return moves[i]; }
+    const Move* begin() const { return moves; }
+    const Move* end() const { return moves + count; }
+};
+
+/*
+CLASS: MoveGenerator
+PURPOSE: Enumerates every legal single, pair, triple and five-card hand (straight, flush, full house,
+         four of a kind plus one, straight flush) a hand can play on a trick, straight from the hand
+         mask. Straights run on consecutive Big 2 values without wrapping, so 3-7 is the lowest and
+         J-Q-K-A-2 the highest.
+METHODS:
+    + generate(hand: CardMask, trick: Move, moves: MoveList&, required: CardMask): int
+DATE: 2026-10-19
+*/
+
+class MoveGenerator {
+public:
+    // Appends the moves that beat trick (every combination when trick is a pass) and contain all
+    // of required, such as the 3 of diamonds on the opening lead. Returns the number appended.
+    // Hands must hold at most MAX_HAND_SIZE cards.
+    static int generate(CardMask hand, const Move& trick, MoveList& moves, CardMask required = 0);
+};
+
+#endif
\ No newline at end of file
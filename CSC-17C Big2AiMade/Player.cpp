@@ -3,7 +3,7 @@
 #include <algorithm>
 #include <vector>
 
-Player::Player(const std::string& name) : name(name), handSize(0), nextIndex(0) {
+Player::Player(const std::string& name) : handMask(0), name(name), handSize(0), nextIndex(0) {
     // Map is automatically initialized empty
 }
 
@@ -13,10 +13,12 @@ Player::~Player() {
         delete pair.second;
     }
     hand.clear();
+    handMask = 0;
 }
 
 void Player::addCard(Card* card) {
     hand[nextIndex++] = card;
+    handMask |= card->getMask();
     handSize++;
 }
 
@@ -25,6 +27,7 @@ Card* Player::removeCard(int index) {
     if (it != hand.end()) {
         Card* card = it->second;
         hand.erase(it);
+        handMask &= ~card->getMask();
         handSize--;
         return card;
     }
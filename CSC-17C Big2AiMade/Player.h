@@ -11,6 +11,7 @@ PURPOSE: Represents a player in the Big 2 game
 ATTRIBUTES:
     - name: string
     - hand: map<int, Card*>
+    - handMask: CardMask (bitboard of the cards in hand)
     - handSize: int
 METHODS:
     + Player(name: string)
@@ -19,6 +20,8 @@ METHODS:
     + removeCard(index: int): Card*
     + getHandSize(): int
     + getName(): string
+    + getHandMask(): CardMask
+    + hasCard(index: int): bool
     + sortHand()
     + displayHand(): void
     + begin(): iterator
@@ -37,6 +40,8 @@ public:
     Card* removeCard(int index);
     int getHandSize() const;
     const std::string& getName() const;
+    CardMask getHandMask() const { return handMask; }
+    bool hasCard(int index) const { return (handMask & cardBit(index)) != 0; }
     void sortHand();
     void displayHand() const;
     
@@ -48,6 +53,7 @@ public:
 
 protected:
     std::map<int, Card*> hand;
+    CardMask handMask;
     
 private:
     std::string name;
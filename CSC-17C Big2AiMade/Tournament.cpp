@@ -0,0 +1,250 @@
+#include "Tournament.h"
+#include "AIPlayer.h"
+#include "GameEngine.h"
+#include "MCTSPlayer.h"
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+inline std::uint64_t packRange(std::uint64_t begin, std::uint64_t end) {
+    return (begin << 32) | end;
+}
+
+inline std::uint64_t rangeBegin(std::uint64_t range) {
+    return range >> 32;
+}
+
+inline std::uint64_t rangeEnd(std::uint64_t range) {
+    return range & 0xFFFFFFFFULL;
+}
+
+// SplitMix64 finalizer: spreads consecutive numbers over unrelated seeds
+inline std::uint64_t mixSeed(std::uint64_t value) {
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+}  // namespace
+
+Tournament::Tournament(const std::vector<std::string>& entrantSpecs, long long gameCount, int threadCount,
+                       std::uint64_t tournamentSeed)
+    : entrants(entrantSpecs), games((gameCount + 3) / 4 * 4), threads(threadCount), seed(tournamentSeed),
+      steals(0), elapsedSeconds(0) {
+    if (entrants.size() != NUM_ENTRANTS) {
+        throw std::invalid_argument("A tournament needs exactly four entrants");
+    }
+    for (const std::string& spec : entrants) {
+        createAgent(spec);  // Throws for an unknown spec
+    }
+    if (gameCount <= 0 || games > 0xFFFFFFFFLL) {
+        throw std::invalid_argument("Game count must be between 1 and 2^32 - 1");
+    }
+    if (threads <= 0) {
+        threads = static_cast<int>(std::thread::hardware_concurrency());
+        if (threads <= 0) {
+            threads = 1;
+        }
+    }
+    for (Tally& tally : tallies) {
+        tally.wins = 0;
+        tally.dealWinSquares = 0;
+        tally.cardsLeft = 0;
+    }
+}
+
+std::unique_ptr<Agent> Tournament::createAgent(const std::string& spec) {
+    // ai<difficulty>[:<endgame cards>], the difficulty's own endgame threshold by default
+    if (spec.size() >= 3 && spec.compare(0, 2, "ai") == 0 && spec[2] >= '1' && spec[2] <= '3' &&
+        (spec.size() == 3 || spec[3] == ':')) {
+        std::unique_ptr<AIPlayer> player(new AIPlayer(spec, spec[2] - '0'));
+        if (spec.size() > 3) {
+            int cards = -1;
+            std::size_t used = 0;
+            try {
+                cards = std::stoi(spec.substr(4), &used);
+            } catch (const std::logic_error&) {
+                cards = -1;  // Not a number
+            }
+            if (cards < 0 || used != spec.size() - 4) {
+                throw std::invalid_argument("Bad AI entrant (use ai<1-3> or ai<1-3>:<endgame cards>): " + spec);
+            }
+            player->setEndgameCards(cards);
+        }
+        return std::unique_ptr<Agent>(player.release());
+    }
+
+    // mcts[:<n>ms|:<n>p[:<threads>]], 50 ms and one thread by default
+    if (spec == "mcts" || spec.compare(0, 5, "mcts:") == 0) {
+        int timeLimit = 50;
+        int playouts = 0;
+        int searchThreads = 1;
+        if (spec.size() > 5) {
+            std::string fields = spec.substr(5);
+            std::size_t colon = fields.find(':');
+            std::string budget = fields.substr(0, colon);
+            std::string unit;
+            long amount = 0;
+            std::size_t used = 0;
+            try {
+                amount = std::stol(budget, &used);
+                unit = budget.substr(used);
+                if (colon != std::string::npos) {
+                    searchThreads = std::stoi(fields.substr(colon + 1), &used);
+                    if (used != fields.size() - colon - 1) {
+                        searchThreads = 0;
+                    }
+                }
+            } catch (const std::logic_error&) {
+                amount = 0;  // Not a number
+            }
+            if (amount <= 0 || (unit != "ms" && unit != "p") || searchThreads <= 0) {
+                throw std::invalid_argument("Bad MCTS entrant (use mcts:<n>ms or mcts:<n>p, then :<threads>): " + spec);
+            }
+            timeLimit = unit == "ms" ? static_cast<int>(amount) : 0;
+            playouts = unit == "p" ? static_cast<int>(amount) : 0;
+        }
+        return std::unique_ptr<Agent>(new MCTSPlayer(timeLimit, playouts, searchThreads));
+    }
+    throw std::invalid_argument("Unknown entrant: " + spec);
+}
+
+std::uint64_t Tournament::dealSeed(std::uint64_t tournamentSeed, long long game) {
+    return mixSeed(tournamentSeed ^ mixSeed(static_cast<std::uint64_t>(game / 4)));
+}
+
+void Tournament::run() {
+    // Even contiguous shares of the deals to start with; stealing evens out the rest
+    std::uint64_t deals = static_cast<std::uint64_t>(games / NUM_ENTRANTS);
+    ranges.reset(new WorkRange[threads]);
+    for (int worker = 0; worker < threads; worker++) {
+        std::uint64_t begin = deals * worker / threads;
+        std::uint64_t end = deals * (worker + 1) / threads;
+        ranges[worker].range = packRange(begin, end);
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int worker = 1; worker < threads; worker++) {
+        workers.emplace_back(&Tournament::work, this, worker);
+    }
+    work(0);
+    for (std::thread& thread : workers) {
+        thread.join();
+    }
+    elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // The games of one deal share its cards, so each deal's mean score (wins / 4) is one sample
+    results.clear();
+    const double z = 1.96;
+    double n = static_cast<double>(deals);
+    for (int entrant = 0; entrant < NUM_ENTRANTS; entrant++) {
+        EntrantResult result;
+        result.name = entrants[entrant];
+        result.games = games;
+        result.wins = tallies[entrant].wins;
+        result.cardsLeft = tallies[entrant].cardsLeft;
+
+        double p = static_cast<double>(result.wins) / games;
+        double sumSquares = static_cast<double>(tallies[entrant].dealWinSquares) / (NUM_ENTRANTS * NUM_ENTRANTS);
+        double variance = n > 1 ? std::max(0.0, (sumSquares - n * p * p) / (n - 1)) : 0;
+        double center = p;
+        double halfWidth = z * std::sqrt(variance / n);
+        if (variance == 0) {
+            // Every deal scored the same: the Wilson interval over n deals still has a width
+            double denominator = 1 + z * z / n;
+            center = (p + z * z / (2 * n)) / denominator;
+            halfWidth = z * std::sqrt(p * (1 - p) / n + z * z / (4 * n * n)) / denominator;
+        }
+        result.winRate = p;
+        result.ciLow = std::max(0.0, center - halfWidth);
+        result.ciHigh = std::min(1.0, center + halfWidth);
+        results.push_back(result);
+    }
+}
+
+bool Tournament::takeDeal(int worker, long long& deal) {
+    std::atomic<std::uint64_t>& own = ranges[worker].range;
+    std::uint64_t range = own.load();
+    while (rangeBegin(range) < rangeEnd(range)) {
+        if (own.compare_exchange_weak(range, packRange(rangeBegin(range) + 1, rangeEnd(range)))) {
+            deal = static_cast<long long>(rangeBegin(range));
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Tournament::steal(int worker) {
+    for (int offset = 1; offset < threads; offset++) {
+        std::atomic<std::uint64_t>& victim = ranges[(worker + offset) % threads].range;
+        std::uint64_t range = victim.load();
+        while (rangeBegin(range) < rangeEnd(range)) {
+            // Take the back half (all of it when only one deal is left)
+            std::uint64_t middle = rangeBegin(range) + (rangeEnd(range) - rangeBegin(range)) / 2;
+            if (victim.compare_exchange_weak(range, packRange(rangeBegin(range), middle))) {
+                // Only this worker ever grows its own range, and it is empty here
+                ranges[worker].range.store(packRange(middle, rangeEnd(range)));
+                steals.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void Tournament::work(int worker) {
+    std::unique_ptr<Agent> agents[NUM_ENTRANTS];
+    for (int entrant = 0; entrant < NUM_ENTRANTS; entrant++) {
+        agents[entrant] = createAgent(entrants[entrant]);
+    }
+    long long wins[NUM_ENTRANTS] = {0};
+    long long dealWinSquares[NUM_ENTRANTS] = {0};
+    long long cardsLeft[NUM_ENTRANTS] = {0};
+    GameEngine engine;
+
+    while (true) {
+        long long dealNumber;
+        if (!takeDeal(worker, dealNumber)) {
+            if (!steal(worker)) {
+                break;
+            }
+            continue;
+        }
+
+        // The deal's four games, game number 4 * deal + rotation
+        int dealWins[NUM_ENTRANTS] = {0};
+        for (int rotation = 0; rotation < NUM_ENTRANTS; rotation++) {
+            // Seat s holds entrant (s + rotation) % 4
+            std::uint64_t deal = dealSeed(seed, dealNumber * NUM_ENTRANTS + rotation);
+            Agent* seats[NUM_ENTRANTS];
+            for (int seat = 0; seat < NUM_ENTRANTS; seat++) {
+                seats[seat] = agents[(seat + rotation) % NUM_ENTRANTS].get();
+                seats[seat]->newGame(seat, mixSeed(deal + rotation));
+            }
+            engine.reset(deal);
+            int winner = engine.play(seats);
+
+            dealWins[(winner + rotation) % NUM_ENTRANTS]++;
+            for (int seat = 0; seat < NUM_ENTRANTS; seat++) {
+                cardsLeft[(seat + rotation) % NUM_ENTRANTS] += engine.getCardsLeft(seat);
+            }
+        }
+        for (int entrant = 0; entrant < NUM_ENTRANTS; entrant++) {
+            wins[entrant] += dealWins[entrant];
+            dealWinSquares[entrant] += dealWins[entrant] * dealWins[entrant];
+        }
+    }
+
+    // One lock-free flush per worker
+    for (int entrant = 0; entrant < NUM_ENTRANTS; entrant++) {
+        tallies[entrant].wins.fetch_add(wins[entrant], std::memory_order_relaxed);
+        tallies[entrant].dealWinSquares.fetch_add(dealWinSquares[entrant], std::memory_order_relaxed);
+        tallies[entrant].cardsLeft.fetch_add(cardsLeft[entrant], std::memory_order_relaxed);
+    }
+}
\ No newline at end of file
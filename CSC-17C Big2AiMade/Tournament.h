@@ -0,0 +1,114 @@
+#ifndef TOURNAMENT_H
+#define TOURNAMENT_H
+
+#include "Agent.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+STRUCT: EntrantResult
+PURPOSE: Totals for one tournament entrant, with a 95% confidence interval for its win rate. The four
+         games of a deal are correlated, so the interval treats each deal's mean score as one
+         sample (a Wilson interval over the deals when every deal scored the same)
+ATTRIBUTES:
+    - name: string
+    - games: long long
+    - wins: long long
+    - cardsLeft: long long (cards still held when someone else went out)
+    - winRate: double
+    - ciLow: double
+    - ciHigh: double
+DATE: 2026-10-19
+*/
+
+struct EntrantResult {
+    std::string name;
+    long long games;
+    long long wins;
+    long long cardsLeft;
+    double winRate;
+    double ciLow;
+    double ciHigh;
+};
+
+/*
+CLASS: Tournament
+PURPOSE: Plays many GameEngine games between four entrants on all cores. Games come in groups of
+         four that share one deal (from a per-group seed) with the entrants rotated through every
+         seat, so results depend only on the seed, never on the thread count or scheduling.
+         Each worker owns a range of deal numbers, plays all four games of a deal itself, and
+         steals half of another worker's remaining range when it runs out; ranges and result
+         totals are atomics, so nothing locks.
+ATTRIBUTES:
+    - entrants: vector<string> (agent specs, see createAgent)
+    - games: long long (rounded up to a multiple of 4)
+    - threads: int
+    - seed: uint64_t
+    - ranges: WorkRange[threads] (packed [begin, end) of deal numbers per worker)
+    - tallies: Tally[4] (wins, squared wins per deal and cards left per entrant)
+    - steals: atomic<long long>
+    - results: vector<EntrantResult>
+    - elapsedSeconds: double
+METHODS:
+    + Tournament(entrants: vector<string>, games: long long, threads: int, seed: uint64_t)
+    + run(): void
+    + getResults(): vector<EntrantResult>
+    + getGames(): long long
+    + getElapsedSeconds(): double
+    + getSteals(): long long
+    + createAgent(spec: string): unique_ptr<Agent>
+    + dealSeed(seed: uint64_t, game: long long): uint64_t
+DATE: 2026-10-19
+*/
+
+class Tournament {
+public:
+    static const int NUM_ENTRANTS = 4;
+
+    // Throws invalid_argument unless there are four valid entrant specs and games > 0
+    Tournament(const std::vector<std::string>& entrants, long long games, int threads, std::uint64_t seed);
+    void run();
+
+    const std::vector<EntrantResult>& getResults() const { return results; }
+    long long getGames() const { return games; }
+    int getThreads() const { return threads; }
+    double getElapsedSeconds() const { return elapsedSeconds; }
+    long long getSteals() const { return steals.load(); }
+
+    // "ai1", "ai2" or "ai3": AIPlayer at that difficulty, then ":<n>" to solve endgames of at most
+    // n cards (0 for never). "mcts[:<n>ms|:<n>p[:<threads>]]":
+    // MCTSPlayer with a time or playout budget per move (50 ms, one thread by default)
+    static std::unique_ptr<Agent> createAgent(const std::string& spec);
+
+    // The deal for a game; the four games of a group share it
+    static std::uint64_t dealSeed(std::uint64_t seed, long long game);
+
+private:
+    struct alignas(64) WorkRange {
+        std::atomic<std::uint64_t> range;
+    };
+    struct alignas(64) Tally {
+        std::atomic<long long> wins;
+        std::atomic<long long> dealWinSquares;  // Sum over deals of (wins in that deal)^2
+        std::atomic<long long> cardsLeft;
+    };
+
+    std::vector<std::string> entrants;
+    long long games;
+    int threads;
+    std::uint64_t seed;
+    std::unique_ptr<WorkRange[]> ranges;
+    Tally tallies[NUM_ENTRANTS];
+    std::atomic<long long> steals;
+    std::vector<EntrantResult> results;
+    double elapsedSeconds;
+
+    void work(int worker);
+    bool takeDeal(int worker, long long& deal);
+    bool steal(int worker);
+};
+
+#endif
\ No newline at end of file
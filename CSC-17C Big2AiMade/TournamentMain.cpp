@@ -0,0 +1,71 @@
+#include "Tournament.h"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+// Plays AI entrants against each other on all cores and reports win rates.
+// Usage: big2-tournament [-g games] [-t threads] [-s seed] [entrant entrant entrant entrant]
+
+static void printUsage() {
+    std::cerr << "Usage: big2-tournament [-g games] [-t threads] [-s seed] [entrant x4]\n"
+              << "Entrants: ai1, ai2, ai3[:<endgame cards>] (AIPlayer difficulty),\n"
+              << "          mcts[:<n>ms|:<n>p[:<threads>]] (MCTSPlayer, 50 ms per move by default)\n"
+              << "Default: ai1 ai2 ai3 ai3\n";
+}
+
+int main(int argc, char* argv[]) {
+    long long games = 100000;
+    int threads = 0;
+    unsigned long long seed = 1;
+    std::vector<std::string> entrants;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if ((arg == "-g" || arg == "-t" || arg == "-s") && i + 1 < argc) {
+            char* end = nullptr;
+            unsigned long long value = std::strtoull(argv[++i], &end, 10);
+            if (*end != '\0') {
+                printUsage();
+                return 1;
+            }
+            if (arg == "-g") games = static_cast<long long>(value);
+            else if (arg == "-t") threads = static_cast<int>(value);
+            else seed = value;
+        } else if (arg == "-h" || arg == "--help") {
+            printUsage();
+            return 0;
+        } else {
+            entrants.push_back(arg);
+        }
+    }
+    if (entrants.empty()) {
+        entrants = {"ai1", "ai2", "ai3", "ai3"};
+    }
+
+    try {
+        Tournament tournament(entrants, games, threads, seed);
+        tournament.run();
+
+        std::cout << tournament.getGames() << " games on " << tournament.getThreads() << " threads in "
+                  << std::fixed << std::setprecision(2) << tournament.getElapsedSeconds() << " s ("
+                  << std::setprecision(0) << tournament.getGames() / tournament.getElapsedSeconds()
+                  << " games/s, " << tournament.getSteals() << " steals), seed " << seed << "\n\n";
+
+        std::cout << "#     Entrant       Wins      Win rate  95% CI            Cards left/game\n";
+        int number = 1;
+        for (const EntrantResult& result : tournament.getResults()) {
+            std::cout << std::left << std::setw(6) << number++ << std::setw(14) << result.name
+                      << std::setw(10) << result.wins << std::right << std::setprecision(2)
+                      << std::setw(7) << result.winRate * 100 << "%  "
+                      << "[" << std::setw(5) << result.ciLow * 100 << "%, "
+                      << std::setw(5) << result.ciHigh * 100 << "%]   "
+                      << std::setw(6) << static_cast<double>(result.cardsLeft) / result.games << "\n";
+        }
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        printUsage();
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
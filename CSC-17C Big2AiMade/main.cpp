@@ -1,14 +1,13 @@
-#include "Game.h"
+#include "GameEngine.h"
 #include "AIPlayer.h"
 #include <iostream>
-#include <queue>
-#include <stack>
-#include <limits>
 #include <sstream>
+#include <string>
+#include <vector>
 #include <ctime>
 
 // Function to get valid card indices from user
-std::vector<int> getCardIndices(const Player* player) {
+std::vector<int> getCardIndices(int handSize) {
     std::vector<int> indices;
     std::string input;
     
@@ -23,7 +22,7 @@ std::vector<int> getCardIndices(const Player* player) {
             indices.push_back(-1);
             break;
         }
-        if (index >= 0 && index < player->getHandSize()) {
+        if (index >= 0 && index < handSize) {
             indices.push_back(index);
         }
     }
@@ -31,175 +30,108 @@ std::vector<int> getCardIndices(const Player* player) {
     return indices;
 }
 
-// Function to validate card combination
-bool isValidCombination(const std::vector<Card*>& cards) {
-    if (cards.empty()) return false;
-    if (cards.size() == 1) return true;
-    
-    // Check for pairs
-    if (cards.size() == 2) {
-        return cards[0]->getValue() == cards[1]->getValue();
-    }
-    
-    // Check for three of a kind
-    if (cards.size() == 3) {
-        return cards[0]->getValue() == cards[1]->getValue() && 
-               cards[1]->getValue() == cards[2]->getValue();
-    }
-    
-    // Check for five card combinations
-    if (cards.size() == 5) {
-        // Check for straight
-        bool isStraight = true;
-        for (size_t i = 1; i < cards.size(); ++i) {
-            if (cards[i]->getValue() != cards[i-1]->getValue() + 1) {
-                isStraight = false;
-                break;
-            }
-        }
-        if (isStraight) return true;
-        
-        // Check for flush
-        bool isFlush = true;
-        for (size_t i = 1; i < cards.size(); ++i) {
-            if (cards[i]->getSuit() != cards[0]->getSuit()) {
-                isFlush = false;
-                break;
-            }
-        }
-        if (isFlush) return true;
-        
-        // Check for full house
-        if (cards[0]->getValue() == cards[1]->getValue() && 
-            cards[1]->getValue() == cards[2]->getValue() &&
-            cards[3]->getValue() == cards[4]->getValue()) {
-            return true;
+// Prints the moves of an engine game as they are applied
+class ConsoleObserver : public GameObserver {
+private:
+    const std::string* names;
+
+public:
+    ConsoleObserver(const std::string* playerNames) : names(playerNames) {}
+
+    void onMove(const GameEngine& /*engine*/, int player, const Move& move) override {
+        if (move.isPass()) {
+            std::cout << names[player] << " passes.\n";
+        } else {
+            std::cout << names[player] << " plays: " << maskToString(move.cards) << std::endl;
         }
     }
-    
-    return false;
-}
 
-int main() {
-    srand(time(nullptr));
-    Game game;
-    
-    // Create AI players with different difficulties
-    game.setPlayer(0, new Player("Human")); // Human player
-    game.setPlayer(1, new AIPlayer("AI Easy", 1));
-    game.setPlayer(2, new AIPlayer("AI Medium", 2));
-    game.setPlayer(3, new AIPlayer("AI Hard", 3));
-    
-    game.startGame();
-    
-    std::queue<Player*> turnOrder;
-    std::stack<Card*> lastPlayedCards;
-    
-    // Initialize turn order
-    for (int i = 0; i < 4; ++i) {
-        turnOrder.push(game.getPlayer(i));
+    void onGameOver(const GameEngine& /*engine*/, int winner) override {
+        std::cout << "\n" << names[winner] << " wins!\n";
     }
-    
-    bool gameOver = false;
-    while (!gameOver) {
-        Player* currentPlayer = turnOrder.front();
-        turnOrder.pop();
-        
-        std::cout << "\n=== " << currentPlayer->getName() << "'s turn ===\n";
-        currentPlayer->displayHand();
-        
-        if (!lastPlayedCards.empty()) {
-            std::cout << "Last played card: " << lastPlayedCards.top()->toString() << std::endl;
-        }
-        
-        std::vector<Card*> cardsToPlay;
-        
-        // Handle AI or human player
-        if (dynamic_cast<AIPlayer*>(currentPlayer)) {
-            // Convert last played cards to array for AI
-            std::array<Card*, 5> lastPlayed;
-            std::fill(lastPlayed.begin(), lastPlayed.end(), nullptr);
-            int lastPlayedCount = 0;
-            
-            if (!lastPlayedCards.empty()) {
-                lastPlayed[0] = lastPlayedCards.top();
-                lastPlayedCount = 1;
+};
+
+// Asks the person at the console which cards to play
+class HumanAgent : public Agent {
+private:
+    std::string name;
+
+public:
+    HumanAgent(const std::string& playerName) : name(playerName) {}
+
+    Move chooseMove(const GameEngine& engine, const MoveList& legal) override {
+        CardMask hand = engine.getHand(engine.getCurrentPlayer());
+        const Move& trick = engine.getTrick();
+
+        while (true) {
+            std::cout << "\n=== " << name << "'s turn ===\n";
+            std::cout << name << "'s hand:";
+            int position = 0;
+            for (CardMask cards = hand; cards != 0; ) {
+                std::cout << " [" << position++ << "] " << cardName(popLowestCard(cards));
             }
-            
-            // Get AI's move
-            std::array<Card*, 5> aiMove = dynamic_cast<AIPlayer*>(currentPlayer)->makeMove(lastPlayed, lastPlayedCount);
-            
-            // Convert AI's move to vector
-            for (int i = 0; i < 5 && aiMove[i] != nullptr; ++i) {
-                cardsToPlay.push_back(aiMove[i]);
+            std::cout << std::endl;
+            if (!trick.isPass()) {
+                std::cout << "Last played: " << maskToString(trick.cards) << std::endl;
+            } else if (engine.isFirstMove()) {
+                std::cout << "You lead; your play must include the 3 of diamonds." << std::endl;
             }
-            
-            if (cardsToPlay.empty()) {
-                std::cout << currentPlayer->getName() << " passes.\n";
-                turnOrder.push(currentPlayer);
-                continue;
+
+            std::vector<int> cardIndices = getCardIndices(countCards(hand));
+            if (!std::cin) {
+                return trick.isPass() ? legal[0] : Move{0, 0}; // Input closed: play on automatically
             }
-        } else {
-            // Human player's turn
-            std::vector<int> cardIndices = getCardIndices(currentPlayer);
-            
+
             if (cardIndices.empty() || (cardIndices.size() == 1 && cardIndices[0] == -1)) {
-                std::cout << currentPlayer->getName() << " passes.\n";
-                turnOrder.push(currentPlayer);
-                continue;
-            }
-            
-            // Collect cards to play
-            for (int index : cardIndices) {
-                Card* card = currentPlayer->removeCard(index);
-                if (card) {
-                    cardsToPlay.push_back(card);
+                if (!trick.isPass()) {
+                    return Move{0, 0};
                 }
+                std::cout << "You are leading and cannot pass.\n";
+                continue;
             }
-        }
-        
-        // Validate and play cards
-        if (isValidCombination(cardsToPlay)) {
-            // Clear last played cards
-            while (!lastPlayedCards.empty()) {
-                delete lastPlayedCards.top();
-                lastPlayedCards.pop();
-            }
-            
-            // Add new cards to last played stack
-            for (Card* card : cardsToPlay) {
-                lastPlayedCards.push(card);
+
+            // Positions refer to the hand as displayed, lowest card first
+            int handCards[MAX_HAND_SIZE];
+            int count = 0;
+            for (CardMask cards = hand; cards != 0; ) {
+                handCards[count++] = popLowestCard(cards);
             }
-            
-            std::cout << currentPlayer->getName() << " plays: ";
-            for (Card* card : cardsToPlay) {
-                std::cout << card->toString() << " ";
+            CardMask chosen = 0;
+            for (int index : cardIndices) {
+                chosen |= cardBit(handCards[index]);
             }
-            std::cout << std::endl;
-            
-            // Check for game over
-            if (currentPlayer->getHandSize() == 0) {
-                std::cout << "\n" << currentPlayer->getName() << " wins!\n";
-                gameOver = true;
+
+            for (const Move& move : legal) {
+                if (!move.isPass() && move.cards == chosen) {
+                    return move;
+                }
             }
-        } else {
             std::cout << "Invalid combination. Try again.\n";
-            // Return cards to player's hand
-            for (Card* card : cardsToPlay) {
-                currentPlayer->addCard(card);
-            }
-            turnOrder.push(currentPlayer);
-            continue;
         }
-        
-        turnOrder.push(currentPlayer);
     }
-    
-    // Clean up
-    while (!lastPlayedCards.empty()) {
-        delete lastPlayedCards.top();
-        lastPlayedCards.pop();
+};
+
+int main() {
+    const std::string names[GameEngine::NUM_PLAYERS] = {"Human", "AI Easy", "AI Medium", "AI Hard"};
+
+    // Create AI players with different difficulties
+    HumanAgent human(names[0]);
+    AIPlayer easy(names[1], 1);
+    AIPlayer medium(names[2], 2);
+    AIPlayer hard(names[3], 3);
+    Agent* agents[GameEngine::NUM_PLAYERS] = {&human, &easy, &medium, &hard};
+
+    std::uint64_t seed = static_cast<std::uint64_t>(time(nullptr));
+    for (int seat = 0; seat < GameEngine::NUM_PLAYERS; ++seat) {
+        agents[seat]->newGame(seat, seed);
     }
-    
+
+    ConsoleObserver console(names);
+    GameEngine engine;
+    engine.setObserver(&console);
+    engine.reset(seed);
+    std::cout << names[engine.getCurrentPlayer()] << " holds the 3 of diamonds and starts.\n";
+    engine.play(agents);
+
     return 0;
-}
+}
\ No newline at end of file
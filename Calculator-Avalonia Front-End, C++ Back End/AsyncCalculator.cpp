@@ -0,0 +1,86 @@
+#include "AsyncCalculator.h"
+#include "StringCalculator.h"
+
+// Create the pool (0 threads means one per hardware thread)
+CalculationThreadPool::CalculationThreadPool(unsigned threadCount) : stopping(false) {
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0) {
+            threadCount = 2;
+        }
+    }
+    for (unsigned i = 0; i < threadCount; i++) {
+        workers.push_back(std::thread(&CalculationThreadPool::workerLoop, this));
+    }
+}
+
+// Let queued tasks finish, then join the workers
+CalculationThreadPool::~CalculationThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    available.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+// Number of worker threads
+unsigned CalculationThreadPool::size() const {
+    return static_cast<unsigned>(workers.size());
+}
+
+// Run tasks until the pool is stopping and the queue is empty
+void CalculationThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this]() { return stopping || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        // packaged_task stores any exception in the future
+        task();
+    }
+}
+
+// Returns the process-wide pool used by the asynchronous calculator functions
+CalculationThreadPool& getCalculationThreadPool() {
+    static CalculationThreadPool pool;
+    return pool;
+}
+
+// Run one calculation under its options on the shared pool
+static std::future<std::string> submitCalculation(CalcOperation op, const CalculationOptions& options,
+                                                  std::function<std::string()> calculation) {
+    return getCalculationThreadPool().submit([op, options, calculation]() {
+        CalculationContext context(options);
+        // Work cancelled or expired while queued never starts
+        CalculationContext::checkpoint(op, 0, 0);
+        return calculation();
+    });
+}
+
+std::future<std::string> addNumericStringsAsync(const std::string& num1, const std::string& num2,
+                                                 const CalculationOptions& options) {
+    return submitCalculation(OP_ADD, options, [num1, num2]() { return addNumericStrings(num1, num2); });
+}
+
+std::future<std::string> multiplyNumericStringsAsync(const std::string& num1, const std::string& num2,
+                                                      const CalculationOptions& options) {
+    return submitCalculation(OP_MULTIPLY, options, [num1, num2]() { return multiplyNumericStrings(num1, num2); });
+}
+
+std::future<std::string> divideNumericStringsAsync(const std::string& num1, const std::string& num2,
+                                                    const CalculationOptions& options) {
+    return submitCalculation(OP_DIVIDE, options, [num1, num2]() { return divideNumericStrings(num1, num2); });
+}
+
+std::future<std::string> sqrtNumericStringAsync(const std::string& num, const CalculationOptions& options) {
+    return submitCalculation(OP_SQRT, options, [num]() { return sqrtNumericString(num); });
+}
@@ -0,0 +1,91 @@
+#ifndef ASYNC_CALCULATOR_H
+#define ASYNC_CALCULATOR_H
+
+#include "CalculationContext.h"
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+CLASS: CalculationThreadPool
+PURPOSE: Fixed set of worker threads that run calculator tasks in submission order
+OPERATIONS: submit(task) returning a std::future for the task's result
+LIMITATIONS: The destructor lets queued tasks finish; cancel them through their tokens to exit quickly
+DATE: 2026-10-19
+*/
+class CalculationThreadPool {
+public:
+    // Create the pool (0 threads means one per hardware thread)
+    explicit CalculationThreadPool(unsigned threadCount = 0);
+    ~CalculationThreadPool();
+
+    CalculationThreadPool(const CalculationThreadPool&) = delete;
+    CalculationThreadPool& operator=(const CalculationThreadPool&) = delete;
+
+    // Queue a task; its result or exception is delivered through the returned future
+    template <typename Task>
+    std::future<typename std::result_of<Task()>::type> submit(Task task) {
+        typedef typename std::result_of<Task()>::type Result;
+        std::shared_ptr<std::packaged_task<Result()> > packaged =
+            std::make_shared<std::packaged_task<Result()> >(task);
+        std::future<Result> result = packaged->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push([packaged]() { (*packaged)(); });
+        }
+        available.notify_one();
+        return result;
+    }
+
+    // Number of worker threads
+    unsigned size() const;
+
+private:
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()> > tasks;
+    std::mutex mutex;
+    std::condition_variable available;
+    bool stopping;
+
+    void workerLoop();
+};
+
+/*
+FUNCTION: Returns the process-wide pool used by the asynchronous calculator functions
+INPUT: None
+OUTPUT: Reference to a CalculationThreadPool with one worker per hardware thread
+SCALE: O(1)
+LIMITATIONS: Created on first use
+DATE: 2026-10-19
+*/
+CalculationThreadPool& getCalculationThreadPool();
+
+/*
+FUNCTION: Asynchronous versions of addNumericStrings, multiplyNumericStrings, divideNumericStrings
+          and sqrtNumericString
+INPUT: The same operands as the synchronous functions, plus CalculationOptions (cancellation token,
+       optional deadline, optional progress callback, optional resource limits for this request)
+OUTPUT: std::future<std::string> with the result. get() rethrows std::invalid_argument for bad input,
+        CalculationCancelled when the token was cancelled or the deadline passed, or
+        ResourceLimitExceeded when the request was rejected or ran past its wall-time limit.
+SCALE: Same as the synchronous functions; cancellation is noticed within one inner-loop step
+       (one quotient digit, one multiplication row, one Newton iteration)
+LIMITATIONS: Progress is reported for the innermost running loop; total is 0 when it is not known
+DATE: 2026-10-19
+*/
+std::future<std::string> addNumericStringsAsync(const std::string& num1, const std::string& num2,
+                                                 const CalculationOptions& options = CalculationOptions());
+std::future<std::string> multiplyNumericStringsAsync(const std::string& num1, const std::string& num2,
+                                                      const CalculationOptions& options = CalculationOptions());
+std::future<std::string> divideNumericStringsAsync(const std::string& num1, const std::string& num2,
+                                                    const CalculationOptions& options = CalculationOptions());
+std::future<std::string> sqrtNumericStringAsync(const std::string& num,
+                                                const CalculationOptions& options = CalculationOptions());
+
+#endif // ASYNC_CALCULATOR_H
@@ -0,0 +1,220 @@
+#include "BallNumber.h"
+#include "DigitStrings.h"
+#include <algorithm>
+#include <stdexcept>
+
+// Significant digits kept in radii (always rounded up)
+static const std::size_t RADIUS_DIGITS = 10;
+
+BallNumber::BallNumber() : precision(0) {}
+
+BallNumber::BallNumber(const BigNumber& value, std::size_t precision)
+    : midpoint(value), precision(precision) {}
+
+BallNumber::BallNumber(const BigNumber& midpoint, const BigNumber& radius, std::size_t precision)
+    : midpoint(midpoint), radius(radius.abs()), precision(precision) {
+    round();
+}
+
+BigNumber BallNumber::unit(long long exponent) {
+    BigNumber result;
+    result.digits = "1";
+    result.exponent = static_cast<int>(exponent);
+    return result;
+}
+
+BigNumber BallNumber::truncate(const BigNumber& x, std::size_t digits, BigNumber& error) {
+    std::size_t length = x.digits.length();
+    if (x.isZero() || length <= digits) {
+        error = BigNumber();
+        return x;
+    }
+    long long dropped = static_cast<long long>(length - digits);
+    bool inexact = x.digits.find_first_not_of('0', digits) != std::string::npos;
+    error = inexact ? unit(x.exponent + dropped) : BigNumber();
+
+    BigNumber result;
+    result.digits = x.digits.substr(0, digits);
+    result.exponent = static_cast<int>(x.exponent + dropped);
+    result.isNegative = x.isNegative;
+    result.normalize();
+    return result;
+}
+
+BigNumber BallNumber::upperBound(const BigNumber& x, std::size_t digits) {
+    BigNumber error;
+    BigNumber result = truncate(x, digits, error);
+    return error.isZero() ? result : result + error;
+}
+
+BigNumber BallNumber::divide(const BigNumber& a, const BigNumber& b, std::size_t digits, BigNumber& error) {
+    error = BigNumber();
+    if (a.isZero()) {
+        return BigNumber();
+    }
+
+    // Pad the dividend so the integer quotient has more than digits digits
+    std::size_t la = a.digits.length();
+    std::size_t lb = b.digits.length();
+    std::size_t pad = digits + lb + 1 > la ? digits + lb + 1 - la : 0;
+    std::string padded = a.digits.str();
+    padded.append(pad, '0');
+    std::string quotient = divideDigitStrings(padded, b.digits);
+    long long quotientExponent = static_cast<long long>(a.exponent) - b.exponent - static_cast<long long>(pad);
+
+    // Exact when quotient * divisor gives back the padded dividend
+    BigNumber q;
+    q.digits = quotient;
+    q.normalize();
+    BigNumber divisor;
+    divisor.digits = b.digits;
+    if ((q * divisor).digits.str() != padded) {
+        error = unit(quotientExponent);
+    }
+
+    q.exponent = static_cast<int>(quotientExponent);
+    q.isNegative = a.isNegative != b.isNegative;
+    q.normalize();
+    return q;
+}
+
+BigNumber BallNumber::squareRoot(const BigNumber& a, std::size_t digits, BigNumber& error) {
+    error = BigNumber();
+    if (a.isZero()) {
+        return BigNumber();
+    }
+
+    // As in BigNumber::sqrt: sqrt(d * 10^(2h + r)) = sqrt(d * 10^(r + 2f)) * 10^(h - f), with f chosen
+    // so the integer root has at least digits digits
+    long long r = ((a.exponent % 2) + 2) % 2;
+    long long h = (static_cast<long long>(a.exponent) - r) / 2;
+    long long length = static_cast<long long>(a.digits.length());
+    long long f = std::max(0LL, (2 * static_cast<long long>(digits) - length - r + 1) / 2) + 1;
+    std::string scaled = a.digits.str();
+    scaled.append(static_cast<std::size_t>(r + 2 * f), '0');
+
+    BigNumber root;
+    root.digits = sqrtDigitStrings(scaled);
+    root.normalize();
+    if ((root * root).digits.str() != scaled) {
+        error = unit(h - f);
+    }
+    root.exponent = static_cast<int>(h - f);
+    root.normalize();
+    return root;
+}
+
+void BallNumber::round() {
+    if (precision != 0) {
+        BigNumber error;
+        midpoint = truncate(midpoint, precision, error);
+        if (!error.isZero()) {
+            radius = radius + error;
+        }
+    }
+    radius = upperBound(radius, RADIUS_DIGITS);
+}
+
+BigNumber BallNumber::lower() const {
+    return midpoint - radius;
+}
+
+BigNumber BallNumber::upper() const {
+    return midpoint + radius;
+}
+
+bool BallNumber::isCertified(const NumberFormat& format) const {
+    // Rounding is monotonic, so equal text at both ends means equal text for every value between
+    return radius.isZero() || lower().toString(format) == upper().toString(format);
+}
+
+std::string BallNumber::toString() const {
+    return midpoint.toString() + " +/- " + radius.toString(NumberFormat::scientific(3));
+}
+
+BallNumber BallNumber::operator+(const BallNumber& other) const {
+    return BallNumber(midpoint + other.midpoint, radius + other.radius, std::max(precision, other.precision));
+}
+
+BallNumber BallNumber::operator-(const BallNumber& other) const {
+    return BallNumber(midpoint - other.midpoint, radius + other.radius, std::max(precision, other.precision));
+}
+
+// |xy - ab| <= |a| s + |b| r + r s for x within r of a and y within s of b
+BallNumber BallNumber::operator*(const BallNumber& other) const {
+    BigNumber spread = midpoint.abs() * other.radius + other.midpoint.abs() * radius + radius * other.radius;
+    return BallNumber(midpoint * other.midpoint, spread, std::max(precision, other.precision));
+}
+
+// |x/y - a/b| <= (|a| s + |b| r) / (|b| (|b| - s)) for x within r of a and y within s of b
+BallNumber BallNumber::operator/(const BallNumber& other) const {
+    if (BigNumber::compareAbsoluteValue(other.midpoint, other.radius) <= 0) {
+        throw std::invalid_argument("Division by a ball that contains zero");
+    }
+    std::size_t working = std::max(divisionPrecision(), other.divisionPrecision());
+    BigNumber error;
+    BigNumber quotient = divide(midpoint, other.midpoint, working, error);
+
+    BigNumber spread = error;
+    BigNumber numerator = midpoint.abs() * other.radius + other.midpoint.abs() * radius;
+    if (!numerator.isZero()) {
+        BigNumber denominator = other.midpoint.abs() * (other.midpoint.abs() - other.radius);
+        BigNumber boundError;
+        spread = spread + divide(numerator, denominator, RADIUS_DIGITS, boundError) + boundError;
+    }
+    return BallNumber(quotient, spread, std::max(precision, other.precision));
+}
+
+BallNumber BallNumber::sqrt() const {
+    BigNumber top = upper();
+    if (top.isNeg()) {
+        throw std::invalid_argument("Cannot compute square root of negative number");
+    }
+    std::size_t working = divisionPrecision();
+    BigNumber bottom = lower();
+
+    // The ball reaches below zero: the root lies in [0, sqrt(top)]
+    if (bottom.isNeg()) {
+        BigNumber error;
+        BigNumber half = (squareRoot(top, working, error) + error) * BigNumber("0.5");
+        return BallNumber(half, half, precision);
+    }
+
+    BigNumber error;
+    BigNumber root = squareRoot(midpoint, working, error);
+    BigNumber spread = error;
+    if (!radius.isZero()) {
+        BigNumber boundError;
+        if (bottom.isZero()) {
+            // |sqrt(x) - sqrt(m)| <= sqrt(|x - m|)
+            spread = spread + squareRoot(radius, RADIUS_DIGITS, boundError) + boundError;
+        } else {
+            // |sqrt(x) - sqrt(m)| = |x - m| / (sqrt(x) + sqrt(m)) <= r / sqrt(m - r)
+            BigNumber unused;
+            BigNumber rootBottom = squareRoot(bottom, RADIUS_DIGITS, unused);
+            spread = spread + divide(radius, rootBottom, RADIUS_DIGITS, boundError) + boundError;
+        }
+    }
+    return BallNumber(root, spread, precision);
+}
+
+std::string BallNumber::evaluate(const std::function<BallNumber(std::size_t precision)>& expression,
+                                 const NumberFormat& format, std::size_t maxPrecision) {
+    std::size_t digits = format.significantDigits;
+    if (digits == 0) {
+        throw std::invalid_argument("Certified evaluation needs a number of significant digits");
+    }
+    if (maxPrecision == 0) {
+        maxPrecision = 32 * (digits + 10);
+    }
+
+    for (std::size_t working = std::min(digits + 10, maxPrecision);; working = std::min(2 * working, maxPrecision)) {
+        BallNumber value = expression(working);
+        if (value.isCertified(format)) {
+            return value.lower().toString(format);
+        }
+        if (working == maxPrecision) {
+            throw std::runtime_error("Result could not be certified to " + std::to_string(digits) + " digits");
+        }
+    }
+}
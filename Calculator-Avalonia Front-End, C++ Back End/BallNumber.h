@@ -0,0 +1,96 @@
+#ifndef BALL_NUMBER_H
+#define BALL_NUMBER_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include "BigNumber.h"
+#include "NumberFormat.h"
+
+/*
+CLASS: BallNumber
+PURPOSE: Ball (midpoint-radius interval) arithmetic over BigNumber. Every operation rounds its midpoint
+         to the working precision and widens the radius by the rounding error, so the true value is
+         always inside [midpoint - radius, midpoint + radius]. evaluate() raises the working precision
+         only until the ball determines the requested digits.
+OPERATIONS: +, -, *, / and sqrt with certified error bounds; lower/upper bounds; certification check
+            against a NumberFormat; adaptive evaluation of an expression
+LIMITATIONS: Midpoints are rounded toward zero to the working precision in significant digits (0 keeps
+             +, - and * exact; / and sqrt then use 20 digits, like BigNumber). Radii are kept to 10
+             significant digits, rounded up. Division by a ball that contains zero throws.
+DATE: 2026-10-19
+*/
+class BallNumber {
+public:
+    // Working precision used by / and sqrt when a ball carries none
+    static const std::size_t DEFAULT_PRECISION = 20;
+
+    // Exact zero
+    BallNumber();
+
+    // Exact value (radius zero) with a working precision in significant digits
+    BallNumber(const BigNumber& value, std::size_t precision = 0);
+
+    // Value known to lie within radius of midpoint
+    BallNumber(const BigNumber& midpoint, const BigNumber& radius, std::size_t precision);
+
+    const BigNumber& getMidpoint() const { return midpoint; }
+    const BigNumber& getRadius() const { return radius; }
+    std::size_t getPrecision() const { return precision; }
+
+    // Bounds of the ball
+    BigNumber lower() const;
+    BigNumber upper() const;
+
+    // Check if every value in the ball formats to the same text
+    bool isCertified(const NumberFormat& format) const;
+
+    // "midpoint +/- radius"
+    std::string toString() const;
+
+    // Arithmetic; the result uses the larger working precision of the operands
+    BallNumber operator+(const BallNumber& other) const;
+    BallNumber operator-(const BallNumber& other) const;
+    BallNumber operator*(const BallNumber& other) const;
+    BallNumber operator/(const BallNumber& other) const;
+    BallNumber sqrt() const;
+
+    /*
+    FUNCTION: Evaluates an expression at increasing working precision until its result is certified
+    INPUT: The expression (builds its inputs with the precision it is given), the output format with
+           significantDigits > 0, and the largest precision to try (0 means 32 * (digits + 10))
+    OUTPUT: std::string, the value formatted with format, correct in every shown digit
+    SCALE: Precision starts at digits + 10 and doubles, so the last evaluation dominates the cost
+    LIMITATIONS: Throws std::runtime_error when maxPrecision is reached first (for example when the
+                 exact value is a rounding tie that the expression cannot compute exactly)
+    DATE: 2026-10-19
+    */
+    static std::string evaluate(const std::function<BallNumber(std::size_t precision)>& expression,
+                                const NumberFormat& format, std::size_t maxPrecision = 0);
+
+private:
+    // Round the midpoint to the working precision and the radius up to a few digits
+    void round();
+
+    // Working precision for / and sqrt
+    std::size_t divisionPrecision() const { return precision != 0 ? precision : DEFAULT_PRECISION; }
+
+    // 10^exponent
+    static BigNumber unit(long long exponent);
+
+    // x cut to its leading digits (toward zero); error receives a bound on what was dropped
+    static BigNumber truncate(const BigNumber& x, std::size_t digits, BigNumber& error);
+
+    // Upper bound for a non-negative x with at most digits significant digits
+    static BigNumber upperBound(const BigNumber& x, std::size_t digits);
+
+    // a / b and sqrt(a) truncated to at least digits significant digits, with an error bound
+    static BigNumber divide(const BigNumber& a, const BigNumber& b, std::size_t digits, BigNumber& error);
+    static BigNumber squareRoot(const BigNumber& a, std::size_t digits, BigNumber& error);
+
+    BigNumber midpoint;
+    BigNumber radius;
+    std::size_t precision;
+};
+
+#endif // BALL_NUMBER_H
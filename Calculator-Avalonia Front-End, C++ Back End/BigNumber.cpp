@@ -1,11 +1,23 @@
 #include "BigNumber.h"
+#include "CalculationContext.h"
+#include "DigitStrings.h"
+#include "DoubleConversion.h"
+#include "LimbArithmetic.h"
+#include "PerformanceCounters.h"
+#include "TuningConfig.h"
 #include <algorithm>
+#include <climits>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
 #include <vector>
 
+// Largest argument accepted by factorial, binomial and primorial (primes are sieved up to it)
+static const unsigned long MAX_COMBINATORIAL_ARGUMENT = 999999999UL;
+
 // Default constructor - creates zero
-BigNumber::BigNumber() : digits("0"), exponent(0), isNegative(false) {}
+BigNumber::BigNumber() : exponent(0), isNegative(false) {}
 
 // Constructor from string
 BigNumber::BigNumber(const std::string& numStr) {
@@ -14,6 +26,8 @@ BigNumber::BigNumber(const std::string& numStr) {
 
 // Parse string to BigNumber
 void BigNumber::parse(const std::string& numStr) {
+    ScopedOperationTimer timer(OP_PARSE, numStr.length());
+    
     digits = "";
     exponent = 0;
     isNegative = false;
@@ -28,7 +42,7 @@ void BigNumber::parse(const std::string& numStr) {
     }
 
     std::string mantissa;
-    int expValue = 0;
+    long long expValue = 0;
     bool hasExponent = false;
 
     // Find 'e' or '^' for scientific notation
@@ -38,7 +52,17 @@ void BigNumber::parse(const std::string& numStr) {
         mantissa = numStr.substr(startPos, ePos - startPos);
         // Extract exponent value
         std::string expStr = numStr.substr(ePos + 1);
-        expValue = std::stoi(expStr);
+        size_t used = 0;
+        try {
+            expValue = std::stoll(expStr, &used);
+        } catch (const std::out_of_range&) {
+            throw std::invalid_argument("Exponent out of range: " + expStr);
+        } catch (const std::invalid_argument&) {
+            throw std::invalid_argument("Malformed exponent: " + expStr);
+        }
+        if (used != expStr.length()) {
+            throw std::invalid_argument("Malformed exponent: " + expStr);
+        }
         hasExponent = true;
     } else {
         mantissa = numStr.substr(startPos);
@@ -66,9 +90,15 @@ void BigNumber::parse(const std::string& numStr) {
         isNegative = false;
     }
 
-    // Apply scientific notation exponent
-    if (hasExponent) {
-        exponent += expValue;
+    // Apply scientific notation exponent; the digit positions from the last digit to the leading one
+    // must all fit in an int
+    if (hasExponent && digits != "0") {
+        long long total = static_cast<long long>(exponent) + expValue;
+        if (total < -static_cast<long long>(INT_MAX) ||
+            total + static_cast<long long>(digits.length()) > static_cast<long long>(INT_MAX)) {
+            throw std::invalid_argument("Exponent out of range: " + numStr.substr(ePos + 1));
+        }
+        exponent = static_cast<int>(total);
     }
     
     // Normalize representation
@@ -77,7 +107,15 @@ void BigNumber::parse(const std::string& numStr) {
 
 // Normalize the BigNumber representation
 void BigNumber::normalize() {
-    if (digits.empty() || digits == "0") {
+    // Remove leading zeros (they carry no weight)
+    size_t firstNonZero = digits.find_first_not_of('0');
+    if (firstNonZero == std::string::npos) {
+        digits = "0";
+    } else if (firstNonZero > 0) {
+        digits.mutate().erase(0, firstNonZero);
+    }
+    
+    if (digits == "0") {
         digits = "0";
         exponent = 0;
         isNegative = false;
@@ -97,7 +135,7 @@ void BigNumber::normalize() {
         
         int zerosToRemove = std::min(trailingZeros, -exponent);
         if (zerosToRemove > 0) {
-            digits = digits.substr(0, digits.length() - zerosToRemove);
+            digits.mutate().erase(digits.length() - zerosToRemove);
             exponent += zerosToRemove;
         }
     }
@@ -105,154 +143,165 @@ void BigNumber::normalize() {
 
 // Addition operator
 BigNumber BigNumber::operator+(const BigNumber& other) const {
-    // If one number is negative and the other is positive, use subtraction
-    if (isNegative && !other.isNegative) {
-        BigNumber temp = *this;
-        temp.isNegative = false;
-        return other - temp;
+    ScopedOperationTimer timer(OP_ADD, std::max(digits.length(), other.digits.length()));
+    timer.addBytes(std::max(digits.length(), other.digits.length()) + 1);
+    
+    // Same signs: add magnitudes and keep the sign
+    if (isNegative == other.isNegative) {
+        return addMagnitudes(*this, other, isNegative);
+    }
+    
+    // Different signs: subtract the smaller magnitude from the larger one
+    int cmp = compareAbsoluteValue(*this, other);
+    if (cmp == 0) {
+        return BigNumber();
     }
-    if (!isNegative && other.isNegative) {
-        BigNumber temp = other;
-        temp.isNegative = false;
-        return *this - temp;
+    if (cmp > 0) {
+        return subtractMagnitudes(*this, other, isNegative);
     }
+    return subtractMagnitudes(other, *this, other.isNegative);
+}
 
-    // Determine which number has more digits before decimal point
-    int thisBeforeDecimal = digits.length() + exponent;
-    int otherBeforeDecimal = other.digits.length() + other.exponent;
-    
-    // Align numbers for addition
-    std::string alignedThis = digits;
-    std::string alignedOther = other.digits;
+// Subtraction operator
+BigNumber BigNumber::operator-(const BigNumber& other) const {
+    ScopedOperationTimer timer(OP_SUBTRACT, std::max(digits.length(), other.digits.length()));
+    timer.addBytes(std::max(digits.length(), other.digits.length()));
     
-    int resultExponent = std::min(exponent, other.exponent);
+    // a - b is a + (-b); zero is never negative
+    bool otherNegated = !other.isNegative && !other.isZero();
     
-    // Pad with zeros to align decimal points
-    if (exponent > resultExponent) {
-        alignedThis.append(exponent - resultExponent, '0');
-    } else if (other.exponent > resultExponent) {
-        alignedOther.append(other.exponent - resultExponent, '0');
+    if (isNegative == otherNegated) {
+        return addMagnitudes(*this, other, isNegative);
     }
     
-    // Ensure both numbers have the same length by padding left with zeros
-    if (alignedThis.length() < alignedOther.length()) {
-        alignedThis = std::string(alignedOther.length() - alignedThis.length(), '0') + alignedThis;
-    } else if (alignedOther.length() < alignedThis.length()) {
-        alignedOther = std::string(alignedThis.length() - alignedOther.length(), '0') + alignedOther;
+    int cmp = compareAbsoluteValue(*this, other);
+    if (cmp == 0) {
+        return BigNumber();
+    }
+    if (cmp > 0) {
+        return subtractMagnitudes(*this, other, isNegative);
+    }
+    return subtractMagnitudes(other, *this, otherNegated);
+}
+
+// Add |a| + |b| over exponent-aligned digit windows without materializing alignment padding
+BigNumber BigNumber::addMagnitudes(const BigNumber& a, const BigNumber& b, bool negative) {
+    if (a.isZero()) {
+        BigNumber result = b;
+        result.isNegative = negative && !b.isZero();
+        return result;
+    }
+    if (b.isZero()) {
+        BigNumber result = a;
+        result.isNegative = negative;
+        return result;
     }
     
-    // Perform addition
-    std::string resultDigits;
+    // Positions are powers of ten: digit k of x (from the right) sits at x.exponent + k.
+    // 64-bit arithmetic keeps huge exponents from overflowing.
+    long long aHigh = a.exponent + static_cast<long long>(a.digits.length());
+    long long bHigh = b.exponent + static_cast<long long>(b.digits.length());
+    const BigNumber& upper = aHigh >= bHigh ? a : b;
+    const BigNumber& lower = aHigh >= bHigh ? b : a;
+    long long upperHigh = std::max(aHigh, bHigh);
+    long long lowerHigh = std::min(aHigh, bHigh);
+    long long low = std::min(a.exponent, b.exponent);
+    const std::string& upperDigits = upper.digits.str();
+    
+    // out[i] sits at position upperHigh - 1 - i. Each output digit is written once: upper's digits
+    // above lower's window (then the gap down to lower's window, if any), lower's window, and
+    // upper's digits below lower's window.
+    std::string out;
+    out.reserve(static_cast<size_t>(upperHigh - low + 1));
+    size_t upperAbove = static_cast<size_t>(std::min(upperHigh - lowerHigh, static_cast<long long>(upperDigits.length())));
+    out.append(upperDigits, 0, upperAbove);
+    if (upper.exponent > lowerHigh) {
+        out.append(static_cast<size_t>(upper.exponent - lowerHigh), '0');
+    }
+    out.append(lower.digits.str());
+    if (upper.exponent < lower.exponent) {
+        out.append(upperDigits, static_cast<size_t>(upperHigh - lower.exponent), std::string::npos);
+    }
+    
+    // Add upper's digits only where the two windows overlap, then carry upward
+    long long overlapLow = std::max(upper.exponent, lower.exponent);
     int carry = 0;
-    
-    for (int i = alignedThis.length() - 1; i >= 0; i--) {
-        int digit1 = alignedThis[i] - '0';
-        int digit2 = alignedOther[i] - '0';
-        
-        int sum = digit1 + digit2 + carry;
-        carry = sum / 10;
-        sum %= 10;
-        
-        resultDigits.push_back(sum + '0');
+    size_t i = static_cast<size_t>(upperHigh - overlapLow);
+    for (long long position = overlapLow; position < lowerHigh; position++) {
+        i--;
+        int sum = (out[i] - '0') + (upperDigits[static_cast<size_t>(upperHigh - 1 - position)] - '0') + carry;
+        carry = sum >= 10 ? 1 : 0;
+        out[i] = static_cast<char>('0' + sum - 10 * carry);
     }
-    
     if (carry > 0) {
-        resultDigits.push_back(carry + '0');
+        // The carry turns the run of nines above the overlap into zeros
+        size_t stop = i == 0 ? std::string::npos : out.find_last_not_of('9', i - 1);
+        size_t nines = stop == std::string::npos ? 0 : stop + 1;
+        std::fill(out.begin() + nines, out.begin() + i, '0');
+        if (stop == std::string::npos) {
+            out.insert(out.begin(), '1');
+        } else {
+            out[stop]++;
+        }
     }
     
-    std::reverse(resultDigits.begin(), resultDigits.end());
-    
-    // Create result
-    BigNumber result("0");
-    result.digits = resultDigits;
-    result.exponent = resultExponent;
-    result.isNegative = isNegative; // Both numbers have the same sign
+    BigNumber result;
+    result.digits = std::move(out);
+    result.exponent = static_cast<int>(low);
+    result.isNegative = negative;
     result.normalize();
-    
     return result;
 }
 
-// Subtraction operator
-BigNumber BigNumber::operator-(const BigNumber& other) const {
-    // Handle sign differences
-    if (isNegative && !other.isNegative) {
-        BigNumber temp = *this;
-        temp.isNegative = false;
-        BigNumber result = temp + other;
-        result.isNegative = true;
+// Subtract |smaller| from |larger| (requires |larger| >= |smaller|) over aligned digit windows
+BigNumber BigNumber::subtractMagnitudes(const BigNumber& larger, const BigNumber& smaller, bool negative) {
+    if (smaller.isZero()) {
+        BigNumber result = larger;
+        result.isNegative = negative && !larger.isZero();
         return result;
     }
-    if (!isNegative && other.isNegative) {
-        BigNumber temp = other;
-        temp.isNegative = false;
-        return *this + temp;
-    }
-    
-    // Determine which number has greater absolute value
-    bool thisGreater = (compareAbsoluteValue(*this, other) >= 0);
-    
-    // Align numbers for subtraction
-    std::string alignedThis = digits;
-    std::string alignedOther = other.digits;
     
-    int resultExponent = std::min(exponent, other.exponent);
+    // Neither window has leading zeros, so larger's window starts at or above smaller's
+    long long largerHigh = larger.exponent + static_cast<long long>(larger.digits.length());
+    long long low = std::min(larger.exponent, smaller.exponent);
     
-    // Pad with zeros to align decimal points
-    if (exponent > resultExponent) {
-        alignedThis.append(exponent - resultExponent, '0');
-    } else if (other.exponent > resultExponent) {
-        alignedOther.append(other.exponent - resultExponent, '0');
-    }
-    
-    // Ensure both numbers have the same length by padding left with zeros
-    if (alignedThis.length() < alignedOther.length()) {
-        alignedThis = std::string(alignedOther.length() - alignedThis.length(), '0') + alignedThis;
-    } else if (alignedOther.length() < alignedThis.length()) {
-        alignedOther = std::string(alignedThis.length() - alignedOther.length(), '0') + alignedOther;
-    }
+    // out[i] sits at position largerHigh - 1 - i: larger's window, then zeros down to smaller's
+    // lowest digit (the subtraction borrows through them)
+    std::string out;
+    out.reserve(static_cast<size_t>(largerHigh - low));
+    out.append(larger.digits.str());
+    out.append(static_cast<size_t>(larger.exponent - low), '0');
     
-    // Perform subtraction (greater - smaller)
-    std::string resultDigits;
     int borrow = 0;
-    
-    // If this number is less than other, swap them and negate the result
-    if (!thisGreater) {
-        std::swap(alignedThis, alignedOther);
-    }
-    
-    for (int i = alignedThis.length() - 1; i >= 0; i--) {
-        int digit1 = alignedThis[i] - '0';
-        int digit2 = alignedOther[i] - '0';
-        
-        digit1 -= borrow;
-        
-        if (digit1 < digit2) {
-            digit1 += 10;
-            borrow = 1;
-        } else {
-            borrow = 0;
+    size_t i = static_cast<size_t>(largerHigh - smaller.exponent);
+    for (size_t k = smaller.digits.length(); k-- > 0;) {
+        i--;
+        int diff = (out[i] - '0') - (smaller.digits[k] - '0') - borrow;
+        borrow = diff < 0 ? 1 : 0;
+        out[i] = static_cast<char>('0' + diff + 10 * borrow);
+    }
+    if (borrow > 0 && i > 0) {
+        // The borrow turns the run of zeros above smaller's window into nines (|larger| >= |smaller|,
+        // so a non-zero digit stops it)
+        size_t stop = out.find_last_not_of('0', i - 1);
+        if (stop != std::string::npos) {
+            std::fill(out.begin() + stop + 1, out.begin() + i, '9');
+            out[stop]--;
         }
-        
-        int diff = digit1 - digit2;
-        resultDigits.push_back(diff + '0');
     }
     
-    std::reverse(resultDigits.begin(), resultDigits.end());
-    
-    // Create result
-    BigNumber result("0");
-    result.digits = resultDigits;
-    result.exponent = resultExponent;
-    
-    // Determine result sign
-    result.isNegative = (isNegative == thisGreater);
-    
+    BigNumber result;
+    result.digits = std::move(out);
+    result.exponent = static_cast<int>(low);
+    result.isNegative = negative;
     result.normalize();
     return result;
 }
 
 // Multiplication operator
 BigNumber BigNumber::operator*(const BigNumber& other) const {
+    ScopedOperationTimer timer(OP_MULTIPLY, std::max(digits.length(), other.digits.length()));
+    
     // Handle special case: either number is zero
     if (isZero() || other.isZero()) {
         return BigNumber(); // Return zero
@@ -264,10 +313,26 @@ BigNumber BigNumber::operator*(const BigNumber& other) const {
     // Calculate the resulting exponent
     int resultExponent = exponent + other.exponent;
     
+    // Large operands: multiply nine digits at a time (Karatsuba above its threshold)
+    if (std::min(digits.length(), other.digits.length()) >= TuningConfig::limbMultiplyDigits()) {
+        LimbVector product = multiplyLimbVectors(digitsToLimbs(digits), digitsToLimbs(other.digits));
+        timer.addBytes(product.size() * sizeof(std::uint32_t));
+        
+        BigNumber resultNum;
+        resultNum.digits = limbsToDigits(product.data(), product.size());
+        resultNum.exponent = resultExponent;
+        resultNum.isNegative = resultNegative;
+        resultNum.normalize();
+        return resultNum;
+    }
+    
     // Perform long multiplication, digit by digit
     std::vector<int> result(digits.length() + other.digits.length(), 0);
+    timer.addBytes(result.size() * (sizeof(int) + 1));
     
     for (int i = digits.length() - 1; i >= 0; i--) {
+        CalculationContext::checkpoint(OP_MULTIPLY, digits.length() - 1 - i, digits.length());
+        
         int carry = 0;
         int digit1 = digits[i] - '0';
         
@@ -301,7 +366,7 @@ BigNumber BigNumber::operator*(const BigNumber& other) const {
     
     // Create the result BigNumber
     BigNumber resultNum;
-    resultNum.digits = resultDigits;
+    resultNum.digits = std::move(resultDigits);
     resultNum.exponent = resultExponent;
     resultNum.isNegative = resultNegative;
     resultNum.normalize();
@@ -311,6 +376,8 @@ BigNumber BigNumber::operator*(const BigNumber& other) const {
 
 // Division operator
 BigNumber BigNumber::operator/(const BigNumber& other) const {
+    ScopedOperationTimer timer(OP_DIVIDE, std::max(digits.length(), other.digits.length()));
+    
     // Check for division by zero
     if (other.isZero()) {
         throw std::invalid_argument("Division by zero");
@@ -324,155 +391,115 @@ BigNumber BigNumber::operator/(const BigNumber& other) const {
     // Determine the sign of the result
     bool resultNegative = (isNegative != other.isNegative);
     
-    // Work with absolute values for division
+    // Work with absolute values for division (copies share the digit buffers)
     BigNumber dividend = abs();
     BigNumber divisor = other.abs();
     
-    // Scale numbers to integers for easier division
-    // We'll shift the decimal point right by adding zeros
-    int shiftAmount = 20; // Precision control - adjust as needed
-    
-    // Adjust exponents
-    int dividendExp = dividend.exponent;
-    int divisorExp = divisor.exponent;
-    
-    // Create new numbers with adjusted exponents
-    BigNumber scaledDividend = dividend;
-    BigNumber scaledDivisor = divisor;
-    
-    // Ensure both numbers are integers by scaling
-    scaledDividend.exponent = 0;
-    scaledDivisor.exponent = 0;
-    
-    // Adjust the result exponent
-    int resultExponent = dividendExp - divisorExp;
-    
-    // Pad dividend with zeros for precision
-    scaledDividend.digits.append(shiftAmount, '0');
-    
-    // Long division algorithm
-    std::string quotientDigits;
-    std::string remainderDigits = scaledDividend.digits;
+    // The last quotient digit kept depends only on the quotient's magnitude, so the same value gives
+    // the same digits however its operands are written (1e30 or 1 followed by 30 zeros)
+    long long lastPosition = lastKeptPosition(quotientLead(dividend, divisor));
     
-    // Perform division
-    while (!remainderDigits.empty()) {
-        // Find how many times divisor goes into the current remainder
-        int quotientDigit = 0;
-        std::string currentChunk;
-        
-        if (remainderDigits.length() < scaledDivisor.digits.length()) {
-            // If remainder is smaller than divisor, add a zero to quotient and more digits from dividend
-            if (!quotientDigits.empty()) {
-                quotientDigits += '0';
-            }
-            break;
-        }
-        
-        // Extract enough digits from remainder to be compared with divisor
-        currentChunk = remainderDigits.substr(0, scaledDivisor.digits.length());
-        
-        if (currentChunk < scaledDivisor.digits) {
-            // Need one more digit from remainder
-            if (remainderDigits.length() > scaledDivisor.digits.length()) {
-                currentChunk += remainderDigits[scaledDivisor.digits.length()];
-                remainderDigits = remainderDigits.substr(scaledDivisor.digits.length() + 1);
-            } else {
-                // No more digits, so add 0 to quotient
-                quotientDigits += '0';
-                break;
-            }
-        } else {
-            remainderDigits = remainderDigits.substr(scaledDivisor.digits.length());
-        }
-        
-        // Find how many times divisor goes into currentChunk
-        while (currentChunk.length() >= scaledDivisor.digits.length() && 
-               (currentChunk.length() > scaledDivisor.digits.length() || currentChunk >= scaledDivisor.digits)) {
-            BigNumber chunkNum("0");
-            chunkNum.digits = currentChunk;
-            chunkNum.exponent = 0;
-            
-            BigNumber subtractAmount = scaledDivisor;
-            
-            currentChunk = (chunkNum - subtractAmount).digits;
-            quotientDigit++;
-        }
-        
-        quotientDigits += std::to_string(quotientDigit);
-        remainderDigits = currentChunk + remainderDigits;
-        
-        // Remove leading zeros from remainder
-        size_t firstNonZero = remainderDigits.find_first_not_of('0');
-        if (firstNonZero != std::string::npos) {
-            remainderDigits = remainderDigits.substr(firstNonZero);
-        } else {
-            remainderDigits = "";
-        }
-    }
+    // Scale the dividend so the integer quotient of the digit strings ends at that position:
+    // zeros appended, or dividend digits below it dropped (the only copy of its digits division makes)
+    long long shiftAmount = static_cast<long long>(dividend.exponent) - divisor.exponent - lastPosition;
+    std::string paddedDividend = scaleDigitString(dividend.digits, shiftAmount);
+    timer.addBytes(3 * paddedDividend.length() + divisor.digits.length());
     
-    // If quotient is empty, it's zero
-    if (quotientDigits.empty()) {
-        return BigNumber();
-    }
+    // Long division of the aligned digit windows
+    std::string quotientDigits = divideDigitStrings(paddedDividend, divisor.digits);
     
-    // Create result
-    BigNumber result("0");
-    result.digits = quotientDigits;
-    result.exponent = resultExponent - shiftAmount; // Adjust for the scaling we did
+    // Create result (normalize drops the quotient's leading zeros)
+    BigNumber result;
+    result.digits = std::move(quotientDigits);
+    result.exponent = static_cast<int>(lastPosition);
     result.isNegative = resultNegative;
     result.normalize();
     
     return result;
 }
 
+// RESULT_DIGITS digits after the point, or RESULT_DIGITS significant digits for results below one
+long long BigNumber::lastKeptPosition(long long lead) {
+    return std::min<long long>(-RESULT_DIGITS, lead - (RESULT_DIGITS - 1));
+}
+
+// a = 0.A * 10^(la + ea) and b = 0.B * 10^(lb + eb), so the quotient leads at 10^(la + ea - lb - eb),
+// one position lower when the digits A, read as a fraction, are below B
+long long BigNumber::quotientLead(const BigNumber& a, const BigNumber& b) {
+    long long lead = (static_cast<long long>(a.digits.length()) + a.exponent) -
+                     (static_cast<long long>(b.digits.length()) + b.exponent);
+    size_t length = std::max(a.digits.length(), b.digits.length());
+    for (size_t i = 0; i < length; i++) {
+        char digitA = i < a.digits.length() ? a.digits[i] : '0';
+        char digitB = i < b.digits.length() ? b.digits[i] : '0';
+        if (digitA != digitB) {
+            return digitA < digitB ? lead - 1 : lead;
+        }
+    }
+    return lead;
+}
+
+// The number leads at 10^v, so its root leads at 10^floor(v / 2)
+long long BigNumber::sqrtLead() const {
+    long long v = static_cast<long long>(digits.length()) - 1 + exponent;
+    return (v - (((v % 2) + 2) % 2)) / 2;
+}
+
 // Compare absolute values of two BigNumbers
 int BigNumber::compareAbsoluteValue(const BigNumber& a, const BigNumber& b) {
-    // Compare number of digits before decimal point
-    int aBeforeDecimal = a.digits.length() + a.exponent;
-    int bBeforeDecimal = b.digits.length() + b.exponent;
+    // Zero has no leading digit position, so handle it first
+    if (a.isZero() || b.isZero()) {
+        return (a.isZero() ? 0 : 1) - (b.isZero() ? 0 : 1);
+    }
+    
+    // Compare the position of the leading digit (digits carry no leading zeros)
+    long long aBeforeDecimal = a.digits.length() + static_cast<long long>(a.exponent);
+    long long bBeforeDecimal = b.digits.length() + static_cast<long long>(b.exponent);
     
     if (aBeforeDecimal != bBeforeDecimal) {
         return aBeforeDecimal > bBeforeDecimal ? 1 : -1;
     }
     
-    // Align and compare digits
-    std::string alignedA = a.digits;
-    std::string alignedB = b.digits;
-    
-    // Align decimal points
-    int minExponent = std::min(a.exponent, b.exponent);
-    
-    if (a.exponent > minExponent) {
-        alignedA.append(a.exponent - minExponent, '0');
-    } else if (b.exponent > minExponent) {
-        alignedB.append(b.exponent - minExponent, '0');
+    // Leading digits are aligned: compare the common window directly
+    size_t common = std::min(a.digits.length(), b.digits.length());
+    int cmp = a.digits.str().compare(0, common, b.digits.str(), 0, common);
+    if (cmp != 0) {
+        return cmp > 0 ? 1 : -1;
     }
     
-    // Pad to equal length
-    if (alignedA.length() < alignedB.length()) {
-        alignedA = std::string(alignedB.length() - alignedA.length(), '0') + alignedA;
-    } else if (alignedB.length() < alignedA.length()) {
-        alignedB = std::string(alignedA.length() - alignedB.length(), '0') + alignedB;
+    // The longer window wins if any of its remaining digits is non-zero
+    if (a.digits.length() > common) {
+        return a.digits.find_first_not_of('0', common) != std::string::npos ? 1 : 0;
     }
-    
-    // Compare digit by digit
-    return alignedA.compare(alignedB);
+    if (b.digits.length() > common) {
+        return b.digits.find_first_not_of('0', common) != std::string::npos ? -1 : 0;
+    }
+    return 0;
 }
 
 // Convert to string for output
 std::string BigNumber::toString() const {
+    ScopedOperationTimer timer(OP_TO_STRING, digits.length());
+    
     if (digits == "0") {
         return "0";
     }
     
     std::string result = isNegative ? "-" : "";
     
+    // Size the output once instead of growing it while padding
+    if (exponent >= 0) {
+        result.reserve(result.length() + digits.length() + exponent);
+    } else {
+        result.reserve(result.length() + std::max(digits.length(), static_cast<size_t>(-exponent)) + 2);
+    }
+    
     if (exponent >= 0) {
         // No decimal point needed, or it's after all digits
         result += digits;
         result.append(exponent, '0');
     } else {
-        int absExp = -exponent;
+        size_t absExp = static_cast<size_t>(-static_cast<long long>(exponent));
         
         if (absExp >= digits.length()) {
             // 0.000...digits
@@ -490,7 +517,104 @@ std::string BigNumber::toString() const {
     return result;
 }
 
-// Returns absolute value of this number
+// Insert a separator between groups of the integer digits in text (after any sign, before any point)
+static void groupIntegerDigits(std::string& text, char separator, size_t groupSize) {
+    size_t begin = (!text.empty() && text[0] == '-') ? 1 : 0;
+    size_t end = text.find_first_not_of("0123456789", begin);
+    if (end == std::string::npos) {
+        end = text.length();
+    }
+    if (separator == '\0' || groupSize == 0 || end - begin <= groupSize) {
+        return;
+    }
+    std::string grouped = text.substr(0, begin);
+    grouped.reserve(text.length() + (end - begin) / groupSize);
+    for (size_t i = begin; i < end; i++) {
+        if (i > begin && (end - i) % groupSize == 0) {
+            grouped += separator;
+        }
+        grouped += text[i];
+    }
+    grouped.append(text, end, std::string::npos);
+    text.swap(grouped);
+}
+
+// Convert to string with the given notation, significant digits and grouping
+std::string BigNumber::toString(const NumberFormat& format) const {
+    if (format.notation == NumberFormat::PLAIN && format.significantDigits == 0) {
+        std::string text = toString();
+        groupIntegerDigits(text, format.groupSeparator, format.groupSize);
+        return text;
+    }
+    size_t length = digits.length();
+    size_t shown = format.significantDigits == 0 ? length : format.significantDigits;
+    ScopedOperationTimer timer(OP_TO_STRING, std::min(length, shown + 1));
+    
+    if (isZero()) {
+        return "0";
+    }
+    
+    // Leading digits, rounded half away from zero; the rest of the digits are never read.
+    // scientificExponent is the power of ten of the first digit.
+    long long scientificExponent = static_cast<long long>(length) + exponent - 1;
+    std::string lead = digits.substr(0, std::min(shown, length));
+    if (shown < length && digits[shown] >= '5') {
+        size_t i = lead.length();
+        while (i > 0 && lead[i - 1] == '9') {
+            lead[--i] = '0';
+        }
+        if (i > 0) {
+            lead[i - 1]++;
+        } else {
+            // 99.9 rounded up to 100: one more integer digit, the same number of significant digits
+            lead.insert(lead.begin(), '1');
+            lead.pop_back();
+            scientificExponent++;
+        }
+    }
+    
+    if (format.notation == NumberFormat::PLAIN) {
+        // Rounded value written out in full
+        BigNumber rounded;
+        rounded.digits = lead;
+        rounded.exponent = static_cast<int>(scientificExponent - static_cast<long long>(lead.length()) + 1);
+        rounded.isNegative = isNegative;
+        rounded.normalize();
+        std::string text = rounded.toString();
+        groupIntegerDigits(text, format.groupSeparator, format.groupSize);
+        return text;
+    }
+    
+    // Pad to the requested precision so the number of shown digits reflects it
+    if (lead.length() < shown) {
+        lead.append(shown - lead.length(), '0');
+    }
+    
+    // Engineering notation moves one to three digits in front of the point
+    long long shownExponent = scientificExponent;
+    size_t integerDigits = 1;
+    if (format.notation == NumberFormat::ENGINEERING) {
+        long long remainder = ((scientificExponent % 3) + 3) % 3;
+        shownExponent = scientificExponent - remainder;
+        integerDigits = static_cast<size_t>(remainder) + 1;
+        if (lead.length() < integerDigits) {
+            lead.append(integerDigits - lead.length(), '0');
+        }
+    }
+    
+    std::string text = isNegative ? "-" : "";
+    text.append(lead, 0, integerDigits);
+    groupIntegerDigits(text, format.groupSeparator, format.groupSize);
+    if (lead.length() > integerDigits) {
+        text += '.';
+        text.append(lead, integerDigits, std::string::npos);
+    }
+    text += 'e';
+    text += std::to_string(shownExponent);
+    return text;
+}
+
+// Returns absolute value of this number (O(1): the digits are shared, not copied)
 BigNumber BigNumber::abs() const {
     BigNumber result = *this;
     result.isNegative = false;
@@ -499,6 +623,8 @@ BigNumber BigNumber::abs() const {
 
 // Square root operation - using Newton's method
 BigNumber BigNumber::sqrt() const {
+    ScopedOperationTimer timer(OP_SQRT, digits.length());
+    
     // Check for negative number
     if (isNegative) {
         throw std::invalid_argument("Cannot compute square root of negative number");
@@ -509,41 +635,18 @@ BigNumber BigNumber::sqrt() const {
         return BigNumber();
     }
     
-    // Initial guess: 10^(exponent/2)
-    BigNumber guess("1");
-    int expGuess = exponent / 2;
-    if (expGuess > 0) {
-        std::string zeros(expGuess, '0');
-        guess.digits += zeros;
-    } else if (expGuess < 0) {
-        // For numbers less than 1, start with 1
-        guess.exponent = expGuess;
-    }
-    
-    // Newton's method: x_next = (x + n/x) / 2
-    const int maxIterations = 20;  // Adjust based on precision needs
-    BigNumber two("2");
-    BigNumber prev;
+    // Keep digits down to a position set by the root's magnitude, like division:
+    // sqrt(d * 10^e) = sqrt(d * 10^(e - 2p)) * 10^p, so the integer root of the scaled digits ends at 10^p
+    long long lastPosition = lastKeptPosition(sqrtLead());
+    std::string scaled = scaleDigitString(digits, exponent - 2 * lastPosition);
+    timer.addBytes(3 * scaled.length());
     
-    for (int i = 0; i < maxIterations; i++) {
-        prev = guess;
-        
-        // Calculate n/x
-        BigNumber quotient = *this / guess;
-        
-        // Calculate (x + n/x)
-        BigNumber sum = guess + quotient;
-        
-        // Calculate (x + n/x) / 2
-        guess = sum / two;
-        
-        // Check for convergence (when guess doesn't change significantly)
-        if (guess.toString() == prev.toString()) {
-            break;
-        }
-    }
+    BigNumber result;
+    result.digits = sqrtDigitStrings(scaled);
+    result.exponent = static_cast<int>(lastPosition);
+    result.normalize();
     
-    return guess;
+    return result;
 }
 
 // Check if the number is zero
@@ -560,4 +663,227 @@ bool BigNumber::isNeg() const {
 int BigNumber::sign() const {
     if (isZero()) return 0;
     return isNegative ? -1 : 1;
-} 
\ No newline at end of file
+} 
+
+// Primes up to n (sieve of Eratosthenes)
+static std::vector<std::uint32_t> primesUpTo(unsigned long n) {
+    std::vector<std::uint32_t> primes;
+    if (n < 2) {
+        return primes;
+    }
+    std::vector<char> composite(n + 1, 0);
+    for (unsigned long p = 2; p <= n; p++) {
+        if (composite[p]) {
+            continue;
+        }
+        primes.push_back(static_cast<std::uint32_t>(p));
+        for (unsigned long long multiple = static_cast<unsigned long long>(p) * p; multiple <= n; multiple += p) {
+            composite[multiple] = 1;
+        }
+    }
+    return primes;
+}
+
+// Exponent of prime p in n! (Legendre's formula)
+static unsigned long legendreExponent(unsigned long n, std::uint32_t p) {
+    unsigned long exponentSum = 0;
+    for (unsigned long q = n / p; q > 0; q /= p) {
+        exponentSum += q;
+    }
+    return exponentSum;
+}
+
+// Product of primes[i]^exponents[i]. Works from the highest exponent bit down, squaring the running
+// product and multiplying in the primes whose exponent has that bit set, so the large prime powers
+// come from squarings instead of repeated multiplication.
+static LimbVector productOfPrimePowers(const std::vector<std::uint32_t>& primes,
+                                       const std::vector<unsigned long>& exponents) {
+    unsigned long highest = 0;
+    for (unsigned long e : exponents) {
+        highest = std::max(highest, e);
+    }
+    
+    LimbVector result(1, 1u);
+    int bit = 0;
+    while (bit + 1 < static_cast<int>(sizeof(unsigned long) * 8) && (highest >> (bit + 1)) != 0) {
+        bit++;
+    }
+    
+    for (; highest != 0 && bit >= 0; bit--) {
+        if (result.size() > 1 || result[0] != 1) {
+            result = multiplyLimbVectors(result, result);
+        }
+        
+        // Pack the selected primes into factors below 10^9 for the product tree
+        std::vector<std::uint32_t> factors;
+        std::uint64_t packed = 1;
+        for (size_t i = 0; i < primes.size(); i++) {
+            if (((exponents[i] >> bit) & 1UL) == 0) {
+                continue;
+            }
+            if (packed * primes[i] >= LIMB_BASE) {
+                factors.push_back(static_cast<std::uint32_t>(packed));
+                packed = 1;
+            }
+            packed *= primes[i];
+        }
+        if (packed > 1) {
+            factors.push_back(static_cast<std::uint32_t>(packed));
+        }
+        if (!factors.empty()) {
+            result = multiplyLimbVectors(result, productTree(factors));
+        }
+    }
+    return result;
+}
+
+// Wrap non-negative limbs as a BigNumber integer
+static BigNumber integerFromLimbs(const LimbVector& limbs) {
+    return BigNumber(limbsToDigits(limbs.data(), limbs.size()));
+}
+
+// Factorial n! from the prime factorization of n!
+BigNumber BigNumber::factorial(unsigned long n) {
+    if (n > MAX_COMBINATORIAL_ARGUMENT) {
+        throw std::invalid_argument("Factorial argument too large");
+    }
+    
+    std::vector<std::uint32_t> primes = primesUpTo(n);
+    std::vector<unsigned long> exponents(primes.size());
+    for (size_t i = 0; i < primes.size(); i++) {
+        exponents[i] = legendreExponent(n, primes[i]);
+    }
+    return integerFromLimbs(productOfPrimePowers(primes, exponents));
+}
+
+// Binomial coefficient C(n, k) from exponents e_p(n!) - e_p(k!) - e_p((n - k)!), without any division
+BigNumber BigNumber::binomial(unsigned long n, unsigned long k) {
+    if (n > MAX_COMBINATORIAL_ARGUMENT) {
+        throw std::invalid_argument("Binomial argument too large");
+    }
+    if (k > n) {
+        return BigNumber();
+    }
+    
+    std::vector<std::uint32_t> primes = primesUpTo(n);
+    std::vector<unsigned long> exponents(primes.size());
+    for (size_t i = 0; i < primes.size(); i++) {
+        exponents[i] = legendreExponent(n, primes[i]) - legendreExponent(k, primes[i]) -
+                       legendreExponent(n - k, primes[i]);
+    }
+    return integerFromLimbs(productOfPrimePowers(primes, exponents));
+}
+
+// Primorial n# (product of the primes up to n)
+BigNumber BigNumber::primorial(unsigned long n) {
+    if (n > MAX_COMBINATORIAL_ARGUMENT) {
+        throw std::invalid_argument("Primorial argument too large");
+    }
+    
+    std::vector<std::uint32_t> primes = primesUpTo(n);
+    return integerFromLimbs(productOfPrimePowers(primes, std::vector<unsigned long>(primes.size(), 1UL)));
+}
+
+// Split a finite double into its binary significand and exponent (value = mantissa * 2^exponent)
+static std::uint64_t decomposeDouble(double value, int& binaryExponent, bool& negative) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    negative = (bits >> 63) != 0;
+    std::uint64_t mantissa = bits & ((1ULL << 52) - 1);
+    int biased = static_cast<int>((bits >> 52) & 0x7FF);
+    if (biased == 0) {
+        binaryExponent = -1074;
+    } else {
+        mantissa |= 1ULL << 52;
+        binaryExponent = biased - 1075;
+    }
+    return mantissa;
+}
+
+// Exact decimal expansion of the double's binary value
+BigNumber BigNumber::fromDouble(double value) {
+    if (!std::isfinite(value)) {
+        throw std::invalid_argument("Cannot convert infinity or NaN to a number");
+    }
+    int binaryExponent;
+    bool negative;
+    std::uint64_t mantissa = decomposeDouble(value, binaryExponent, negative);
+
+    // Trailing zero bits would only become trailing zero digits
+    while (mantissa != 0 && (mantissa & 1) == 0 && binaryExponent < 0) {
+        mantissa >>= 1;
+        binaryExponent++;
+    }
+
+    BigNumber result;
+    result.digits = binaryToDecimalDigits(mantissa, binaryExponent, result.exponent);
+    result.isNegative = negative;
+    result.normalize();
+    return result;
+}
+
+// Shortest round-trip digits straight from the binary value (Ryu), no formatting or parsing
+BigNumber BigNumber::fromDoubleShortest(double value) {
+    if (!std::isfinite(value)) {
+        throw std::invalid_argument("Cannot convert infinity or NaN to a number");
+    }
+    BigNumber result;
+    if (value == 0) {
+        return result;
+    }
+    std::uint64_t shortest;
+    int decimalExponent;
+    shortestDecimal(std::fabs(value), shortest, decimalExponent);
+    result.digits = std::to_string(shortest);
+    result.exponent = decimalExponent;
+    result.isNegative = value < 0;
+    result.normalize();
+    return result;
+}
+
+// Correctly rounded conversion: Clinger's fast path when both factors are exact doubles, otherwise
+// Eisel-Lemire on the leading 19 digits. When the dropped digits could change the result, the exact
+// value is compared with the halfway point between the two candidates.
+double BigNumber::toDouble() const {
+    static const double EXACT_POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                                 1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                                 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    if (isZero()) {
+        return 0.0;
+    }
+
+    const std::string& text = digits.str();
+    std::size_t significant = text.find_last_not_of('0') + 1;
+    std::size_t taken = std::min<std::size_t>(significant, 19);
+    std::uint64_t w = 0;
+    for (std::size_t i = 0; i < taken; i++) {
+        w = w * 10 + static_cast<std::uint64_t>(text[i] - '0');
+    }
+    long long q = static_cast<long long>(exponent) + static_cast<long long>(text.length() - taken);
+    bool truncated = taken < significant;
+
+    double result;
+    if (!truncated && w <= (1ULL << 53) && q >= -22 && q <= 22) {
+        result = q >= 0 ? static_cast<double>(w) * EXACT_POWERS_OF_TEN[q]
+                        : static_cast<double>(w) / EXACT_POWERS_OF_TEN[-q];
+    } else {
+        std::uint64_t bits = decimalToDoubleBits(w, q);
+        if (truncated && decimalToDoubleBits(w + 1, q) != bits) {
+            // The value lies between w and w + 1 units: it rounds to bits or the next double up
+            double candidate;
+            std::memcpy(&candidate, &bits, sizeof(candidate));
+            int binaryExponent;
+            bool negative;
+            std::uint64_t mantissa = decomposeDouble(candidate, binaryExponent, negative);
+            BigNumber halfway;
+            halfway.digits = binaryToDecimalDigits(2 * mantissa + 1, binaryExponent - 1, halfway.exponent);
+            halfway.normalize();
+            int cmp = compareAbsoluteValue(*this, halfway);
+            if (cmp > 0 || (cmp == 0 && (bits & 1) != 0)) {
+                bits++;
+            }
+        }
+        std::memcpy(&result, &bits, sizeof(result));
+    }
+    return isNegative ? -result : result;
+}
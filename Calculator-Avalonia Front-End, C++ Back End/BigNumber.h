@@ -1,6 +1,9 @@
 #ifndef BIG_NUMBER_H
 #define BIG_NUMBER_H
 
+#include "DigitStorage.h"
+#include "NumberFormat.h"
+#include <cstddef>
 #include <string>
 
 /*
@@ -12,10 +15,47 @@ DATE: 2023-06-11
 */
 class BigNumber {
 private:
-    std::string digits;  // Stores digits without decimal point
+    DigitStorage digits; // Stores digits without decimal point (shared copy-on-write between copies)
     int exponent;        // Position of decimal point
     bool isNegative;     // Sign of the number
 
+    // Fixed-width variant converts directly to and from the digit representation
+    template <std::size_t Bits> friend class FixedBigNumber;
+
+    // Streaming division and square root read the digits directly
+    friend class QuotientDigitGenerator;
+    friend class SqrtDigitGenerator;
+
+    // Columns convert directly to and from their shared limb storage
+    friend class BigNumberColumn;
+
+    // Admission checks estimate result sizes from the digit count and exponent
+    friend class ResourceGovernor;
+
+    // Repeated division converts the digits to limbs once per divisor
+    friend class DivisorContext;
+
+    // Ball arithmetic rounds midpoints and radii at digit positions
+    friend class BallNumber;
+
+    // Add |a| + |b| over exponent-aligned digit windows (no alignment padding is materialized)
+    static BigNumber addMagnitudes(const BigNumber& a, const BigNumber& b, bool negative);
+
+    // Subtract |smaller| from |larger| over exponent-aligned digit windows
+    static BigNumber subtractMagnitudes(const BigNumber& larger, const BigNumber& smaller, bool negative);
+
+    // Digits operator/ and sqrt keep after the point; results below one keep as many significant digits
+    static const int RESULT_DIGITS = 20;
+
+    // Power of ten of the last digit operator/ and sqrt keep for a result whose leading digit is 10^lead
+    static long long lastKeptPosition(long long lead);
+
+    // Power of ten of the leading digit of |a / b| (neither may be zero)
+    static long long quotientLead(const BigNumber& a, const BigNumber& b);
+
+    // Power of ten of the leading digit of the square root (the number must not be zero)
+    long long sqrtLead() const;
+
 public:
     // Constructor from string
     BigNumber(const std::string& numStr);
@@ -23,7 +63,8 @@ public:
     // Default constructor - creates zero
     BigNumber();
     
-    // Parse string to BigNumber
+    // Parse string to BigNumber; throws std::invalid_argument for a malformed exponent or one that
+    // puts a digit outside the int exponent range
     void parse(const std::string& numStr);
     
     // Normalize the BigNumber representation
@@ -47,6 +88,10 @@ public:
     // Convert to string for output
     std::string toString() const;
     
+    // Convert to string in scientific, engineering or grouped notation, reading only the leading
+    // digits that are shown
+    std::string toString(const NumberFormat& format) const;
+    
     // Returns absolute value of this number
     BigNumber abs() const;
     
@@ -61,6 +106,24 @@ public:
     
     // Get the sign of the number (-1, 0, 1)
     int sign() const;
+    
+    // Factorial n! (balanced product tree over the prime factorization, multithreaded)
+    static BigNumber factorial(unsigned long n);
+    
+    // Binomial coefficient C(n, k) (zero when k > n)
+    static BigNumber binomial(unsigned long n, unsigned long k);
+    
+    // Primorial n#, the product of all primes up to n
+    static BigNumber primorial(unsigned long n);
+    
+    // Exact value of a finite double (every double is a finite decimal fraction)
+    static BigNumber fromDouble(double value);
+    
+    // Shortest decimal that converts back to the same double (0.1 rather than its exact expansion)
+    static BigNumber fromDoubleShortest(double value);
+    
+    // Nearest double, ties to even; values past the double range give +-infinity or zero
+    double toDouble() const;
 };
 
 #endif // BIG_NUMBER_H 
\ No newline at end of file
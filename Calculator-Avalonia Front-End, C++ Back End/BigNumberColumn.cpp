@@ -0,0 +1,540 @@
+#include "BigNumberColumn.h"
+#include "LimbArithmetic.h"
+#include "TuningConfig.h"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+// Uncarried slots take values below 10^9, so 2^32 additions stay far below 2^64
+const std::uint64_t CARRY_INTERVAL = 1ULL << 32;
+
+// Spare slots above the widest value for carries out of the accumulated sum
+const std::size_t CARRY_SLOTS = 3;
+
+// Limb magnitude with its scale and sign, used for intermediate products
+struct LimbValue {
+    std::vector<std::uint32_t> limbs;
+    long long limbExponent;
+    bool negative;
+};
+
+// floor(value / 9) for negative values too
+long long floorDivLimb(long long value) {
+    return value >= 0 ? value / LIMB_DIGITS : -((-value + LIMB_DIGITS - 1) / LIMB_DIGITS);
+}
+
+// Multiply two limb values, trimming zero limbs from the result
+LimbValue multiplyValues(const LimbValue& a, const LimbValue& b) {
+    LimbValue result;
+    result.limbExponent = a.limbExponent + b.limbExponent;
+    result.negative = a.negative != b.negative;
+    if (a.limbs.empty() || b.limbs.empty()) {
+        result.limbExponent = 0;
+        result.negative = false;
+        return result;
+    }
+    result.limbs = multiplyLimbVectors(a.limbs, b.limbs);
+    return result;
+}
+
+// Resolve the thread count for a reduction over count values
+unsigned chooseThreadCount(unsigned requested, std::size_t count) {
+    if (requested == 0) {
+        requested = std::thread::hardware_concurrency();
+        if (requested == 0) {
+            requested = 2;
+        }
+    }
+    // Below the tuned number of values per thread a reduction runs on fewer threads
+    std::size_t useful = std::max<std::size_t>(1, count / TuningConfig::parallelColumnValues());
+    return static_cast<unsigned>(std::min<std::size_t>(requested, useful));
+}
+
+// Run task(begin, end, slot) over threadCount contiguous ranges, one per thread
+template <typename Task>
+void runRanges(std::size_t count, unsigned threadCount, Task task) {
+    std::vector<std::thread> workers;
+    std::vector<std::exception_ptr> errors(threadCount);
+    std::size_t chunk = (count + threadCount - 1) / threadCount;
+
+    for (unsigned slot = 1; slot < threadCount; slot++) {
+        std::size_t begin = std::min(count, slot * chunk);
+        std::size_t end = std::min(count, begin + chunk);
+        workers.push_back(std::thread([&task, &errors, begin, end, slot]() {
+            try {
+                task(begin, end, slot);
+            } catch (...) {
+                errors[slot] = std::current_exception();
+            }
+        }));
+    }
+    // The calling thread takes the first range
+    try {
+        task(0, std::min(count, chunk), 0u);
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+// Sums many limb values without propagating carries on each addition. Positive and negative terms go
+// to separate 64-bit slot arrays that are carried every CARRY_INTERVAL additions and once at the end.
+class LimbAccumulator {
+public:
+    // Cover limb positions [lowExponent, highExponent)
+    LimbAccumulator(long long lowExponent, long long highExponent)
+        : base(lowExponent),
+          positive(static_cast<std::size_t>(highExponent - lowExponent) + CARRY_SLOTS, 0),
+          negative(positive.size(), 0),
+          pending(0) {}
+
+    // Add a signed limb value
+    void add(const std::uint32_t* limbs, std::size_t length, long long limbExponent, bool isNegative) {
+        std::uint64_t* slots = (isNegative ? negative.data() : positive.data()) + (limbExponent - base);
+        for (std::size_t i = 0; i < length; i++) {
+            slots[i] += limbs[i];
+        }
+        if (++pending >= CARRY_INTERVAL) {
+            carry(positive);
+            carry(negative);
+            pending = 0;
+        }
+    }
+
+    // Carry both sides and return positive - negative
+    LimbValue result() {
+        carry(positive);
+        carry(negative);
+
+        int cmp = 0;
+        for (std::size_t i = positive.size(); i-- > 0 && cmp == 0;) {
+            if (positive[i] != negative[i]) {
+                cmp = positive[i] > negative[i] ? 1 : -1;
+            }
+        }
+        LimbValue value;
+        value.limbExponent = base;
+        value.negative = cmp < 0;
+        if (cmp == 0) {
+            return value;
+        }
+
+        const std::vector<std::uint64_t>& larger = cmp > 0 ? positive : negative;
+        const std::vector<std::uint64_t>& smaller = cmp > 0 ? negative : positive;
+        std::vector<std::uint32_t>& difference = value.limbs;
+        difference.resize(larger.size());
+        std::uint64_t borrow = 0;
+        for (std::size_t i = 0; i < larger.size(); i++) {
+            std::uint64_t subtrahend = smaller[i] + borrow;
+            borrow = larger[i] < subtrahend ? 1 : 0;
+            difference[i] = static_cast<std::uint32_t>(larger[i] + borrow * LIMB_BASE - subtrahend);
+        }
+        return value;
+    }
+
+private:
+    long long base;                        // Limb exponent of slot 0
+    std::vector<std::uint64_t> positive;
+    std::vector<std::uint64_t> negative;
+    std::uint64_t pending;                 // Additions since the last carry
+
+    // Bring every slot below 10^9
+    static void carry(std::vector<std::uint64_t>& slots) {
+        std::uint64_t carried = 0;
+        for (std::size_t i = 0; i < slots.size(); i++) {
+            std::uint64_t current = slots[i] + carried;
+            slots[i] = current % LIMB_BASE;
+            carried = current / LIMB_BASE;
+        }
+        if (carried != 0) {
+            throw std::overflow_error("BigNumberColumn accumulator overflow");
+        }
+    }
+};
+
+} // namespace
+
+// Create an empty column
+BigNumberColumn::BigNumberColumn() {}
+
+// Reserve space for count values of about limbsPerValue limbs each
+void BigNumberColumn::reserve(std::size_t count, std::size_t limbsPerValue) {
+    entries.reserve(count);
+    limbs.reserve(count * limbsPerValue);
+}
+
+// Append a value
+void BigNumberColumn::push_back(const BigNumber& value) {
+    if (value.isZero()) {
+        appendLimbs(nullptr, 0, 0, false);
+        return;
+    }
+
+    static const std::uint32_t powers[LIMB_DIGITS] = {
+        1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u
+    };
+
+    // Align the exponent down to a multiple of 9; the lowest digit then sits at offset pad
+    long long limbExponent = floorDivLimb(value.exponent);
+    std::size_t pad = static_cast<std::size_t>(value.exponent - limbExponent * LIMB_DIGITS);
+    const std::string& digits = value.digits;
+    std::size_t length = (digits.length() + pad + LIMB_DIGITS - 1) / LIMB_DIGITS;
+
+    Entry entry;
+    entry.offset = limbs.size();
+    entry.length = length;
+    entry.limbExponent = limbExponent;
+    entry.negative = value.isNegative;
+    limbs.resize(limbs.size() + length, 0u);
+
+    std::uint32_t* out = limbs.data() + entry.offset;
+    std::size_t position = pad;
+    for (std::size_t k = digits.length(); k-- > 0; position++) {
+        out[position / LIMB_DIGITS] += static_cast<std::uint32_t>(digits[k] - '0') * powers[position % LIMB_DIGITS];
+    }
+
+    // Drop zero limbs left by trailing zero digits
+    while (entry.length > 0 && out[0] == 0) {
+        out++;
+        entry.offset++;
+        entry.length--;
+        entry.limbExponent++;
+    }
+    entries.push_back(entry);
+}
+
+// Append a numeric string (parsed by BigNumber)
+void BigNumberColumn::push_back(const std::string& numStr) {
+    push_back(BigNumber(numStr));
+}
+
+// Number of values in the column
+std::size_t BigNumberColumn::size() const {
+    return entries.size();
+}
+
+// Check if the column holds no values
+bool BigNumberColumn::empty() const {
+    return entries.empty();
+}
+
+// Remove every value
+void BigNumberColumn::clear() {
+    entries.clear();
+    limbs.clear();
+}
+
+// Read one value back as a BigNumber
+BigNumber BigNumberColumn::at(std::size_t index) const {
+    if (index >= entries.size()) {
+        throw std::out_of_range("BigNumberColumn index out of range");
+    }
+    const Entry& entry = entries[index];
+    return toBigNumber(data(entry), entry.length, entry.limbExponent, entry.negative);
+}
+
+// Element-wise addition
+BigNumberColumn BigNumberColumn::operator+(const BigNumberColumn& other) const {
+    return addColumns(*this, other, false);
+}
+
+// Element-wise subtraction
+BigNumberColumn BigNumberColumn::operator-(const BigNumberColumn& other) const {
+    return addColumns(*this, other, true);
+}
+
+// Element-wise multiplication
+BigNumberColumn BigNumberColumn::operator*(const BigNumberColumn& other) const {
+    if (entries.size() != other.entries.size()) {
+        throw std::invalid_argument("BigNumberColumn sizes differ");
+    }
+
+    BigNumberColumn result;
+    result.reserve(entries.size());
+    std::vector<std::uint32_t> scratch;
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        const Entry& a = entries[i];
+        const Entry& b = other.entries[i];
+        if (a.length == 0 || b.length == 0) {
+            result.appendLimbs(nullptr, 0, 0, false);
+            continue;
+        }
+        scratch.resize(a.length + b.length);
+        multiplyLimbs(data(a), a.length, other.data(b), b.length, scratch.data());
+        result.appendLimbs(scratch.data(), scratch.size(), a.limbExponent + b.limbExponent, a.negative != b.negative);
+    }
+    return result;
+}
+
+// Sum of every value: each thread accumulates its range uncarried, then the partial sums are added
+BigNumber BigNumberColumn::sum(unsigned threadCount) const {
+    threadCount = chooseThreadCount(threadCount, entries.size());
+    std::vector<BigNumber> partial(threadCount);
+
+    runRanges(entries.size(), threadCount, [this, &partial](std::size_t begin, std::size_t end, unsigned slot) {
+        if (begin >= end) {
+            return;
+        }
+        long long low = 0;
+        long long high = 0;
+        bool any = false;
+        for (std::size_t i = begin; i < end; i++) {
+            const Entry& entry = entries[i];
+            if (entry.length == 0) {
+                continue;
+            }
+            long long top = entry.limbExponent + static_cast<long long>(entry.length);
+            low = any ? std::min(low, entry.limbExponent) : entry.limbExponent;
+            high = any ? std::max(high, top) : top;
+            any = true;
+        }
+        if (!any) {
+            return;
+        }
+
+        LimbAccumulator accumulator(low, high);
+        for (std::size_t i = begin; i < end; i++) {
+            const Entry& entry = entries[i];
+            accumulator.add(data(entry), entry.length, entry.limbExponent, entry.negative);
+        }
+        LimbValue value = accumulator.result();
+        partial[slot] = toBigNumber(value.limbs.data(), value.limbs.size(), value.limbExponent, value.negative);
+    });
+
+    BigNumber total;
+    for (const BigNumber& value : partial) {
+        total = total + value;
+    }
+    return total;
+}
+
+// Product of every value: balanced product tree per thread, then the partial products are multiplied
+BigNumber BigNumberColumn::product(unsigned threadCount) const {
+    threadCount = chooseThreadCount(threadCount, entries.size());
+    std::vector<LimbValue> partial(threadCount);
+    for (LimbValue& value : partial) {
+        value.limbs.assign(1, 1u);
+        value.limbExponent = 0;
+        value.negative = false;
+    }
+
+    runRanges(entries.size(), threadCount, [this, &partial](std::size_t begin, std::size_t end, unsigned slot) {
+        // Leaves are the values; each pass multiplies neighbours until one value is left
+        std::vector<LimbValue> level;
+        level.reserve(end - begin);
+        for (std::size_t i = begin; i < end; i++) {
+            const Entry& entry = entries[i];
+            LimbValue leaf;
+            leaf.limbs.assign(data(entry), data(entry) + entry.length);
+            leaf.limbExponent = entry.limbExponent;
+            leaf.negative = entry.negative;
+            if (leaf.limbs.empty()) {
+                partial[slot] = leaf;
+                return;
+            }
+            level.push_back(leaf);
+        }
+        while (level.size() > 1) {
+            std::vector<LimbValue> next;
+            next.reserve((level.size() + 1) / 2);
+            for (std::size_t i = 0; i + 1 < level.size(); i += 2) {
+                next.push_back(multiplyValues(level[i], level[i + 1]));
+            }
+            if (level.size() % 2 != 0) {
+                next.push_back(level.back());
+            }
+            level.swap(next);
+        }
+        if (!level.empty()) {
+            partial[slot] = level[0];
+        }
+    });
+
+    LimbValue total = partial[0];
+    for (std::size_t i = 1; i < partial.size(); i++) {
+        total = multiplyValues(total, partial[i]);
+    }
+
+    return toBigNumber(total.limbs.data(), total.limbs.size(), total.limbExponent, total.negative);
+}
+
+// Sum of a[i] * b[i]: products are formed in a per-thread scratch buffer and accumulated uncarried
+BigNumber BigNumberColumn::dot(const BigNumberColumn& a, const BigNumberColumn& b, unsigned threadCount) {
+    if (a.entries.size() != b.entries.size()) {
+        throw std::invalid_argument("BigNumberColumn sizes differ");
+    }
+
+    threadCount = chooseThreadCount(threadCount, a.entries.size());
+    std::vector<BigNumber> partial(threadCount);
+
+    runRanges(a.entries.size(), threadCount, [&a, &b, &partial](std::size_t begin, std::size_t end, unsigned slot) {
+        long long low = 0;
+        long long high = 0;
+        bool any = false;
+        for (std::size_t i = begin; i < end; i++) {
+            const Entry& x = a.entries[i];
+            const Entry& y = b.entries[i];
+            if (x.length == 0 || y.length == 0) {
+                continue;
+            }
+            long long bottom = x.limbExponent + y.limbExponent;
+            long long top = bottom + static_cast<long long>(x.length + y.length);
+            low = any ? std::min(low, bottom) : bottom;
+            high = any ? std::max(high, top) : top;
+            any = true;
+        }
+        if (!any) {
+            return;
+        }
+
+        LimbAccumulator accumulator(low, high);
+        std::vector<std::uint32_t> scratch;
+        for (std::size_t i = begin; i < end; i++) {
+            const Entry& x = a.entries[i];
+            const Entry& y = b.entries[i];
+            if (x.length == 0 || y.length == 0) {
+                continue;
+            }
+            scratch.resize(x.length + y.length);
+            multiplyLimbs(a.data(x), x.length, b.data(y), y.length, scratch.data());
+            accumulator.add(scratch.data(), scratch.size(), x.limbExponent + y.limbExponent, x.negative != y.negative);
+        }
+        LimbValue value = accumulator.result();
+        partial[slot] = toBigNumber(value.limbs.data(), value.limbs.size(), value.limbExponent, value.negative);
+    });
+
+    BigNumber total;
+    for (const BigNumber& value : partial) {
+        total = total + value;
+    }
+    return total;
+}
+
+// Append a value given as magnitude limbs, trimming zero limbs at both ends
+void BigNumberColumn::appendLimbs(const std::uint32_t* source, std::size_t length, long long limbExponent,
+                                  bool negative) {
+    while (length > 0 && source[length - 1] == 0) {
+        length--;
+    }
+    while (length > 0 && source[0] == 0) {
+        source++;
+        length--;
+        limbExponent++;
+    }
+
+    Entry entry;
+    entry.offset = limbs.size();
+    entry.length = length;
+    entry.limbExponent = length == 0 ? 0 : limbExponent;
+    entry.negative = length != 0 && negative;
+    limbs.insert(limbs.end(), source, source + length);
+    entries.push_back(entry);
+}
+
+// Element-wise a[i] + b[i] with b negated when subtract is set
+BigNumberColumn BigNumberColumn::addColumns(const BigNumberColumn& a, const BigNumberColumn& b, bool subtract) {
+    if (a.entries.size() != b.entries.size()) {
+        throw std::invalid_argument("BigNumberColumn sizes differ");
+    }
+
+    BigNumberColumn result;
+    result.reserve(a.entries.size());
+    std::vector<std::uint32_t> scratch;
+    for (std::size_t i = 0; i < a.entries.size(); i++) {
+        const Entry& x = a.entries[i];
+        const Entry& y = b.entries[i];
+        bool yNegative = y.negative != subtract;
+        if (y.length == 0) {
+            result.appendLimbs(a.data(x), x.length, x.limbExponent, x.negative);
+            continue;
+        }
+        if (x.length == 0) {
+            result.appendLimbs(b.data(y), y.length, y.limbExponent, yNegative);
+            continue;
+        }
+
+        // Both values on a common limb window [low, high)
+        long long low = std::min(x.limbExponent, y.limbExponent);
+        long long high = std::max(x.limbExponent + static_cast<long long>(x.length),
+                                  y.limbExponent + static_cast<long long>(y.length));
+        std::size_t width = static_cast<std::size_t>(high - low);
+        const std::uint32_t* xData = a.data(x);
+        const std::uint32_t* yData = b.data(y);
+        std::size_t xOffset = static_cast<std::size_t>(x.limbExponent - low);
+        std::size_t yOffset = static_cast<std::size_t>(y.limbExponent - low);
+        auto xLimb = [&](std::size_t k) -> std::uint32_t {
+            return k >= xOffset && k < xOffset + x.length ? xData[k - xOffset] : 0u;
+        };
+        auto yLimb = [&](std::size_t k) -> std::uint32_t {
+            return k >= yOffset && k < yOffset + y.length ? yData[k - yOffset] : 0u;
+        };
+
+        scratch.assign(width + 1, 0u);
+        bool negative = x.negative;
+        if (x.negative == yNegative) {
+            std::uint32_t carry = 0;
+            for (std::size_t k = 0; k < width; k++) {
+                std::uint32_t sum = xLimb(k) + yLimb(k) + carry;
+                carry = sum >= LIMB_BASE ? 1u : 0u;
+                scratch[k] = sum - carry * LIMB_BASE;
+            }
+            scratch[width] = carry;
+        } else {
+            // Subtract the smaller magnitude from the larger; the result takes the larger's sign
+            int cmp = 0;
+            for (std::size_t k = width; k-- > 0 && cmp == 0;) {
+                if (xLimb(k) != yLimb(k)) {
+                    cmp = xLimb(k) > yLimb(k) ? 1 : -1;
+                }
+            }
+            if (cmp == 0) {
+                result.appendLimbs(nullptr, 0, 0, false);
+                continue;
+            }
+            negative = cmp > 0 ? x.negative : yNegative;
+            std::uint32_t borrow = 0;
+            for (std::size_t k = 0; k < width; k++) {
+                std::uint32_t larger = cmp > 0 ? xLimb(k) : yLimb(k);
+                std::uint32_t subtrahend = (cmp > 0 ? yLimb(k) : xLimb(k)) + borrow;
+                borrow = larger < subtrahend ? 1u : 0u;
+                scratch[k] = larger + borrow * LIMB_BASE - subtrahend;
+            }
+        }
+        result.appendLimbs(scratch.data(), scratch.size(), low, negative);
+    }
+    return result;
+}
+
+// Pointer to the first limb of a value
+const std::uint32_t* BigNumberColumn::data(const Entry& entry) const {
+    return limbs.data() + entry.offset;
+}
+
+// Convert magnitude limbs worth 10^(9 * limbExponent) each to a BigNumber
+BigNumber BigNumberColumn::toBigNumber(const std::uint32_t* source, std::size_t length, long long limbExponent,
+                                       bool negative) {
+    while (length > 0 && source[length - 1] == 0) {
+        length--;
+    }
+    BigNumber result;
+    if (length == 0) {
+        return result;
+    }
+
+    result.digits = limbsToDigits(source, length);
+    result.exponent = static_cast<int>(limbExponent * LIMB_DIGITS);
+    result.isNegative = negative;
+    result.normalize();
+    return result;
+}
@@ -0,0 +1,89 @@
+#ifndef BIG_NUMBER_COLUMN_H
+#define BIG_NUMBER_COLUMN_H
+
+#include "BigNumber.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+CLASS: BigNumberColumn
+PURPOSE: Contiguous column of many BigNumber values for bulk arithmetic. Every value is stored as
+         base-10^9 limbs in one shared limb array, aligned so its exponent is a multiple of 9, which
+         lets values of different scales be added limb by limb without any string round-trip.
+OPERATIONS: Append and read values; element-wise addition, subtraction and multiplication of two
+            columns; parallel sum, product and dot-product reductions
+LIMITATIONS: Values are immutable once appended. Reductions split the column into one contiguous
+             range per thread; sum and dot accumulate limbs without carrying and normalize once per
+             range, so they take a single pass over the limb array. The product reduction multiplies
+             balanced subtrees and is quadratic in the size of the result.
+DATE: 2026-10-19
+*/
+class BigNumberColumn {
+public:
+    // Create an empty column
+    BigNumberColumn();
+
+    // Reserve space for count values of about limbsPerValue limbs each
+    void reserve(std::size_t count, std::size_t limbsPerValue = 2);
+
+    // Append a value
+    void push_back(const BigNumber& value);
+
+    // Append a numeric string (parsed by BigNumber)
+    void push_back(const std::string& numStr);
+
+    // Number of values in the column
+    std::size_t size() const;
+
+    // Check if the column holds no values
+    bool empty() const;
+
+    // Remove every value
+    void clear();
+
+    // Read one value back as a BigNumber
+    BigNumber at(std::size_t index) const;
+
+    // Element-wise operators (columns must have the same size)
+    BigNumberColumn operator+(const BigNumberColumn& other) const;
+    BigNumberColumn operator-(const BigNumberColumn& other) const;
+    BigNumberColumn operator*(const BigNumberColumn& other) const;
+
+    // Sum of every value (threadCount 0 means one per hardware thread)
+    BigNumber sum(unsigned threadCount = 0) const;
+
+    // Product of every value (1 for an empty column)
+    BigNumber product(unsigned threadCount = 0) const;
+
+    // Sum of a[i] * b[i] (columns must have the same size)
+    static BigNumber dot(const BigNumberColumn& a, const BigNumberColumn& b, unsigned threadCount = 0);
+
+private:
+    // One value: limbs[offset .. offset + length) least significant first, worth 10^(9 * limbExponent) each
+    struct Entry {
+        std::size_t offset;
+        std::size_t length;
+        long long limbExponent;
+        bool negative;
+    };
+
+    std::vector<std::uint32_t> limbs;  // Shared limb storage for every value
+    std::vector<Entry> entries;
+
+    // Append a value given as magnitude limbs, trimming zero limbs at both ends
+    void appendLimbs(const std::uint32_t* source, std::size_t length, long long limbExponent, bool negative);
+
+    // Element-wise a[i] + b[i] with b negated when subtract is set
+    static BigNumberColumn addColumns(const BigNumberColumn& a, const BigNumberColumn& b, bool subtract);
+
+    // Pointer to the first limb of a value
+    const std::uint32_t* data(const Entry& entry) const;
+
+    // Convert magnitude limbs worth 10^(9 * limbExponent) each to a BigNumber
+    static BigNumber toBigNumber(const std::uint32_t* source, std::size_t length, long long limbExponent,
+                                 bool negative);
+};
+
+#endif // BIG_NUMBER_COLUMN_H
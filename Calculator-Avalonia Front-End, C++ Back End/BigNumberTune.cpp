@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BigNumber.h"
+#include "BigNumberColumn.h"
+#include "LimbArithmetic.h"
+#include "TuningConfig.h"
+
+// Measures the algorithm crossovers of this host and writes them to a tuning file that
+// TuningConfig loads at startup. Usage: bignumber-tune [output file]
+
+// Each timing sample runs the operation for at least this long
+static const std::chrono::milliseconds SAMPLE_TIME(20);
+
+// The best of this many samples is kept
+static const int SAMPLES = 3;
+
+static std::mt19937 generator(12345);
+
+// Random operands
+static LimbVector randomLimbs(std::size_t count) {
+    std::uniform_int_distribution<std::uint32_t> limb(0, LIMB_BASE - 1);
+    LimbVector limbs(count);
+    for (std::size_t i = 0; i < count; i++) {
+        limbs[i] = limb(generator);
+    }
+    limbs.back() = std::max<std::uint32_t>(limbs.back(), 1);
+    return limbs;
+}
+
+static std::string randomDigits(std::size_t count) {
+    std::uniform_int_distribution<int> digit(0, 9);
+    std::string digits(count, '0');
+    for (std::size_t i = 0; i < count; i++) {
+        digits[i] = static_cast<char>('0' + digit(generator));
+    }
+    digits[0] = static_cast<char>('1' + digit(generator) % 9);
+    return digits;
+}
+
+// Seconds per call of operation: best of SAMPLES samples, each repeated for at least SAMPLE_TIME
+template <typename Operation>
+static double timeOperation(Operation operation) {
+    typedef std::chrono::steady_clock Clock;
+    double best = 0;
+    for (int sample = 0; sample < SAMPLES; sample++) {
+        Clock::time_point start = Clock::now();
+        Clock::duration elapsed(0);
+        long calls = 0;
+        do {
+            operation();
+            calls++;
+            elapsed = Clock::now() - start;
+        } while (elapsed < SAMPLE_TIME);
+        double perCall = std::chrono::duration<double>(elapsed).count() / calls;
+        if (sample == 0 || perCall < best) {
+            best = perCall;
+        }
+    }
+    return best;
+}
+
+// Smallest candidate from which the tuned variant stays faster than the baseline for every larger
+// candidate; the fallback when it never does
+template <typename Measure>
+static std::size_t findCrossover(const char* name, const std::vector<std::size_t>& candidates, Measure measure,
+                                 std::size_t fallback) {
+    std::cout << name << std::endl;
+    std::size_t crossover = fallback;
+    bool tunedWinsAbove = true;
+    std::vector<bool> wins(candidates.size());
+    for (std::size_t i = 0; i < candidates.size(); i++) {
+        double baseline = 0;
+        double tuned = 0;
+        measure(candidates[i], baseline, tuned);
+        wins[i] = tuned < baseline;
+        std::cout << "  " << candidates[i] << ": " << baseline * 1e6 << " us vs " << tuned * 1e6 << " us"
+                  << (wins[i] ? " (switch)" : "") << std::endl;
+    }
+    for (std::size_t i = candidates.size(); i-- > 0;) {
+        tunedWinsAbove = tunedWinsAbove && wins[i];
+        if (tunedWinsAbove) {
+            crossover = candidates[i];
+        }
+    }
+    std::cout << "  -> " << crossover << std::endl;
+    return crossover;
+}
+
+int main(int argc, char* argv[]) {
+    std::string path = argc > 1 ? argv[1] : TuningConfig::defaultPath();
+
+    // Measure from the compiled-in defaults, not from a previously loaded file
+    TuningParameters defaults;
+    TuningParameters tuned;
+    TuningConfig::set(defaults);
+    unsigned hardwareThreads = std::thread::hardware_concurrency();
+
+    // Schoolbook against one Karatsuba split at n limbs (the halves then use schoolbook)
+    tuned.karatsubaLimbs = findCrossover(
+        "Karatsuba crossover (limbs): schoolbook vs one Karatsuba split",
+        std::vector<std::size_t>{8, 12, 16, 24, 32, 40, 48, 64, 96, 128},
+        [](std::size_t n, double& baseline, double& split) {
+            LimbVector a = randomLimbs(n);
+            LimbVector b = randomLimbs(n);
+            LimbVector out(2 * n);
+            TuningParameters parameters = TuningConfig::get();
+            parameters.karatsubaLimbs = n + 1;
+            TuningConfig::set(parameters);
+            baseline = timeOperation([&]() { multiplyLimbs(a.data(), n, b.data(), n, out.data()); });
+            parameters.karatsubaLimbs = n;
+            TuningConfig::set(parameters);
+            split = timeOperation([&]() { multiplyLimbs(a.data(), n, b.data(), n, out.data()); });
+        },
+        defaults.karatsubaLimbs);
+    TuningConfig::set(tuned);
+
+    // BigNumber's digit loop against the limb path at d digits per operand
+    tuned.limbMultiplyDigits = findCrossover(
+        "Limb multiplication crossover (digits): digit loop vs limbs",
+        std::vector<std::size_t>{9, 12, 16, 20, 25, 30, 40, 50, 60, 80, 120},
+        [](std::size_t d, double& baseline, double& limbs) {
+            BigNumber a(randomDigits(d));
+            BigNumber b(randomDigits(d));
+            TuningParameters parameters = TuningConfig::get();
+            parameters.limbMultiplyDigits = d + 1;
+            TuningConfig::set(parameters);
+            baseline = timeOperation([&]() { BigNumber product = a * b; });
+            parameters.limbMultiplyDigits = d;
+            TuningConfig::set(parameters);
+            limbs = timeOperation([&]() { BigNumber product = a * b; });
+        },
+        defaults.limbMultiplyDigits);
+    TuningConfig::set(tuned);
+
+    if (hardwareThreads >= 2) {
+        // Serial product tree against splitting its top level across two threads
+        tuned.parallelProductFactors = findCrossover(
+            "Parallel product tree crossover (factors): one thread vs two",
+            std::vector<std::size_t>{256, 512, 1024, 2048, 4096, 8192, 16384},
+            [](std::size_t n, double& serial, double& parallel) {
+                std::uniform_int_distribution<std::uint32_t> factor(2, LIMB_BASE - 1);
+                std::vector<std::uint32_t> factors(n);
+                for (std::size_t i = 0; i < n; i++) {
+                    factors[i] = factor(generator);
+                }
+                TuningParameters parameters = TuningConfig::get();
+                parameters.parallelProductFactors = n + 1;
+                TuningConfig::set(parameters);
+                serial = timeOperation([&]() { productTree(factors, 2); });
+                parameters.parallelProductFactors = n;
+                TuningConfig::set(parameters);
+                parallel = timeOperation([&]() { productTree(factors, 2); });
+            },
+            defaults.parallelProductFactors);
+        TuningConfig::set(tuned);
+
+        // Column sum of n values on one thread against two threads of n / 2 values
+        std::size_t columnValues = findCrossover(
+            "Parallel column sum crossover (values): one thread vs two",
+            std::vector<std::size_t>{1024, 2048, 4096, 8192, 16384, 32768, 65536},
+            [](std::size_t n, double& serial, double& parallel) {
+                BigNumberColumn column;
+                column.reserve(n, 3);
+                for (std::size_t i = 0; i < n; i++) {
+                    column.push_back(BigNumber(randomDigits(20) + "." + randomDigits(5)));
+                }
+                TuningParameters parameters = TuningConfig::get();
+                parameters.parallelColumnValues = n + 1;
+                TuningConfig::set(parameters);
+                serial = timeOperation([&]() { column.sum(2); });
+                parameters.parallelColumnValues = n / 2;
+                TuningConfig::set(parameters);
+                parallel = timeOperation([&]() { column.sum(2); });
+            },
+            defaults.parallelColumnValues * 2);
+        tuned.parallelColumnValues = columnValues / 2;
+        TuningConfig::set(tuned);
+    } else {
+        std::cout << "Single hardware thread: keeping the default parallel thresholds" << std::endl;
+    }
+
+    std::ostringstream comment;
+    comment << "Measured on a host with " << hardwareThreads << " hardware threads";
+    if (!TuningConfig::saveFile(path, tuned, comment.str())) {
+        std::cerr << "Error: could not write " << path << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << path << std::endl;
+    return 0;
+}
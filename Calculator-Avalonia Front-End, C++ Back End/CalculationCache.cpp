@@ -0,0 +1,119 @@
+#include "CalculationCache.h"
+
+// Constructor with a byte budget (0 disables caching)
+CalculationCache::CalculationCache(std::size_t capacityBytes)
+    : capacityBytes(capacityBytes), bytesUsed(0), hits(0), misses(0), insertions(0), evictions(0) {}
+
+// Build a cache key from an operation tag and its normalized operands
+std::string CalculationCache::makeKey(char operation, const std::string& operand1, const std::string& operand2) {
+    // '|' is never a valid numeric character, so it separates fields unambiguously
+    std::string key;
+    key.reserve(operand1.length() + operand2.length() + 3);
+    key.push_back(operation);
+    key.push_back('|');
+    key += operand1;
+    key.push_back('|');
+    key += operand2;
+    return key;
+}
+
+// Look up a result; on a hit copies it into result and marks the entry most recently used
+bool CalculationCache::lookup(const std::string& key, std::string& result) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = index.find(key);
+    if (it == index.end()) {
+        misses++;
+        return false;
+    }
+
+    // Move the entry to the front of the recency list
+    entries.splice(entries.begin(), entries, it->second);
+    result = it->second->second;
+    hits++;
+    return true;
+}
+
+// Insert or refresh a result, evicting least recently used entries to stay within capacity
+void CalculationCache::store(const std::string& key, const std::string& result) {
+    std::size_t cost = entryCost(key, result);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (cost > capacityBytes) {
+        return;
+    }
+
+    auto it = index.find(key);
+    if (it != index.end()) {
+        // Refresh an existing entry
+        bytesUsed -= entryCost(key, it->second->second);
+        it->second->second = result;
+        entries.splice(entries.begin(), entries, it->second);
+    } else {
+        entries.push_front(std::make_pair(key, result));
+        index[key] = entries.begin();
+        insertions++;
+    }
+
+    bytesUsed += cost;
+    evictToCapacity();
+}
+
+// Change the byte budget, evicting entries if it shrank
+void CalculationCache::setCapacity(std::size_t newCapacityBytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    capacityBytes = newCapacityBytes;
+    evictToCapacity();
+}
+
+// Remove all entries (statistics are kept)
+void CalculationCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    bytesUsed = 0;
+}
+
+// Reset hit/miss/insertion/eviction counters
+void CalculationCache::resetStatistics() {
+    std::lock_guard<std::mutex> lock(mutex);
+    hits = 0;
+    misses = 0;
+    insertions = 0;
+    evictions = 0;
+}
+
+// Get a consistent snapshot of the counters
+CalculationCache::Statistics CalculationCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    Statistics stats;
+    stats.hits = hits;
+    stats.misses = misses;
+    stats.insertions = insertions;
+    stats.evictions = evictions;
+    stats.entries = entries.size();
+    stats.bytesUsed = bytesUsed;
+    stats.capacityBytes = capacityBytes;
+    return stats;
+}
+
+// Approximate memory charged for one entry
+std::size_t CalculationCache::entryCost(const std::string& key, const std::string& result) {
+    // The key is held twice (list node and index), plus node and bucket overhead
+    const std::size_t overhead = sizeof(std::pair<std::string, std::string>) + sizeof(std::string)
+                               + 8 * sizeof(void*);
+    return 2 * key.length() + result.length() + overhead;
+}
+
+// Drop least recently used entries until bytesUsed fits the capacity (mutex must be held)
+void CalculationCache::evictToCapacity() {
+    while (bytesUsed > capacityBytes && !entries.empty()) {
+        const std::pair<std::string, std::string>& victim = entries.back();
+        bytesUsed -= entryCost(victim.first, victim.second);
+        index.erase(victim.first);
+        entries.pop_back();
+        evictions++;
+    }
+}
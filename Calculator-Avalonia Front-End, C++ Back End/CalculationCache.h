@@ -0,0 +1,79 @@
+#ifndef CALCULATION_CACHE_H
+#define CALCULATION_CACHE_H
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+/*
+CLASS: CalculationCache
+PURPOSE: Bounded, thread-safe LRU cache of calculation results keyed on the operation and its normalized operands
+OPERATIONS: Lookup, insertion with least-recently-used eviction, capacity control, hit/miss statistics
+LIMITATIONS: Capacity is measured in approximate bytes (key + result + bookkeeping), not in entries.
+             A single result larger than the whole capacity is never stored.
+DATE: 2026-10-19
+*/
+class CalculationCache {
+public:
+    // Snapshot of the cache counters
+    struct Statistics {
+        unsigned long long hits;
+        unsigned long long misses;
+        unsigned long long insertions;
+        unsigned long long evictions;
+        std::size_t entries;
+        std::size_t bytesUsed;
+        std::size_t capacityBytes;
+    };
+
+    // Default capacity used by the StringCalculator layer (16 MB)
+    static const std::size_t DEFAULT_CAPACITY_BYTES = 16 * 1024 * 1024;
+
+    // Constructor with a byte budget (0 disables caching)
+    explicit CalculationCache(std::size_t capacityBytes = DEFAULT_CAPACITY_BYTES);
+
+    // Build a cache key from an operation tag and its normalized operands
+    static std::string makeKey(char operation, const std::string& operand1, const std::string& operand2 = "");
+
+    // Look up a result; on a hit copies it into result and marks the entry most recently used
+    bool lookup(const std::string& key, std::string& result);
+
+    // Insert or refresh a result, evicting least recently used entries to stay within capacity
+    void store(const std::string& key, const std::string& result);
+
+    // Change the byte budget, evicting entries if it shrank
+    void setCapacity(std::size_t capacityBytes);
+
+    // Remove all entries (statistics are kept)
+    void clear();
+
+    // Reset hit/miss/insertion/eviction counters
+    void resetStatistics();
+
+    // Get a consistent snapshot of the counters
+    Statistics getStatistics() const;
+
+private:
+    typedef std::list<std::pair<std::string, std::string> > EntryList;
+
+    EntryList entries;  // Most recently used entry at the front
+    std::unordered_map<std::string, EntryList::iterator> index;
+    std::size_t capacityBytes;
+    std::size_t bytesUsed;
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned long long insertions;
+    unsigned long long evictions;
+    mutable std::mutex mutex;
+
+    // Approximate memory charged for one entry
+    static std::size_t entryCost(const std::string& key, const std::string& result);
+
+    // Drop least recently used entries until bytesUsed fits the capacity (mutex must be held)
+    void evictToCapacity();
+};
+
+#endif // CALCULATION_CACHE_H
@@ -0,0 +1,91 @@
+#include "CalculationContext.h"
+#include <algorithm>
+
+thread_local CalculationContext* CalculationContext::current = nullptr;
+
+// Install the options for the current thread
+CalculationContext::CalculationContext(const CalculationOptions& options)
+    : options(options), previous(current), nextProgress(std::chrono::steady_clock::now()),
+      started(nextProgress), hasWallTimeLimit(options.hasLimits && options.limits.maxWallTime.count() > 0) {
+    current = this;
+}
+
+// Restore the enclosing context
+CalculationContext::~CalculationContext() {
+    current = previous;
+}
+
+// Copy the limits of the innermost context that carries some; false when none does
+bool CalculationContext::currentLimits(ResourceLimits& limits) {
+    for (CalculationContext* context = current; context; context = context->previous) {
+        if (context->options.hasLimits) {
+            limits = context->options.limits;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Options of every context installed on this thread, innermost first, with the wall time already used
+// taken off their limits and no progress callback
+std::vector<CalculationOptions> CalculationContext::captureOptions() {
+    std::vector<CalculationOptions> captured;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    for (CalculationContext* context = current; context; context = context->previous) {
+        CalculationOptions options = context->options;
+        options.progress = ProgressCallback();
+        if (context->hasWallTimeLimit) {
+            std::chrono::milliseconds used =
+                std::chrono::duration_cast<std::chrono::milliseconds>(now - context->started);
+            // A zero limit means unlimited, so an exhausted one becomes the shortest real limit
+            options.limits.maxWallTime =
+                std::max(options.limits.maxWallTime - used, std::chrono::milliseconds(1));
+        }
+        captured.push_back(options);
+    }
+    return captured;
+}
+
+// Install the captured contexts, outermost first, so the innermost is polled first as on the source thread
+InheritedCalculationContext::InheritedCalculationContext(const std::vector<CalculationOptions>& captured) {
+    contexts.reserve(captured.size());
+    for (std::size_t i = captured.size(); i > 0; i--) {
+        contexts.push_back(std::unique_ptr<CalculationContext>(new CalculationContext(captured[i - 1])));
+    }
+}
+
+// Remove the contexts innermost first, restoring the worker's own
+InheritedCalculationContext::~InheritedCalculationContext() {
+    while (!contexts.empty()) {
+        contexts.pop_back();
+    }
+}
+
+// Check cancellation, deadline and wall-time limit, and report progress when the interval has elapsed
+void CalculationContext::poll(CalcOperation op, std::size_t done, std::size_t total) {
+    if (options.token.isCancelled()) {
+        throw CalculationCancelled("Calculation cancelled");
+    }
+
+    if (!options.hasDeadline && !options.progress && !hasWallTimeLimit) {
+        return;
+    }
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    if (options.hasDeadline && now >= options.deadline) {
+        throw CalculationCancelled("Calculation deadline exceeded");
+    }
+
+    if (hasWallTimeLimit && now - started >= options.limits.maxWallTime) {
+        double elapsed = std::chrono::duration<double, std::milli>(now - started).count();
+        double limit = static_cast<double>(options.limits.maxWallTime.count());
+        throw ResourceLimitExceeded(ResourceLimitExceeded::WALL_TIME, elapsed, limit,
+                                    "Wall time limit exceeded");
+    }
+
+    if (options.progress && now >= nextProgress) {
+        nextProgress = now + options.progressInterval;
+        options.progress(op, done, total);
+    }
+}
@@ -0,0 +1,144 @@
+#ifndef CALCULATION_CONTEXT_H
+#define CALCULATION_CONTEXT_H
+
+#include "PerformanceCounters.h"
+#include "ResourceGovernor.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+CLASS: CalculationCancelled
+PURPOSE: Exception thrown from inside a calculation when it is cancelled or its deadline passes
+DATE: 2026-10-19
+*/
+class CalculationCancelled : public std::runtime_error {
+public:
+    explicit CalculationCancelled(const std::string& message) : std::runtime_error(message) {}
+};
+
+/*
+CLASS: CancellationToken
+PURPOSE: Shared flag used to stop a running calculation from another thread
+OPERATIONS: cancel(), isCancelled(); copies share the same flag
+LIMITATIONS: Cancellation is cooperative; it takes effect at the next checkpoint in an inner loop
+DATE: 2026-10-19
+*/
+class CancellationToken {
+public:
+    CancellationToken() : flag(std::make_shared<std::atomic<bool> >(false)) {}
+
+    // Request cancellation of every calculation using this token
+    void cancel() { flag->store(true, std::memory_order_relaxed); }
+
+    // Check whether cancellation was requested
+    bool isCancelled() const { return flag->load(std::memory_order_relaxed); }
+
+private:
+    std::shared_ptr<std::atomic<bool> > flag;
+};
+
+// Progress report: operation in its inner loop, work units done and total for that loop (0 if unknown)
+typedef std::function<void(CalcOperation op, std::size_t done, std::size_t total)> ProgressCallback;
+
+/*
+STRUCT: CalculationOptions
+PURPOSE: Cancellation token, optional deadline, optional progress callback and optional resource limits
+         for one calculation
+DATE: 2026-10-19
+*/
+struct CalculationOptions {
+    CancellationToken token;
+    bool hasDeadline;
+    std::chrono::steady_clock::time_point deadline;
+    ProgressCallback progress;
+    std::chrono::milliseconds progressInterval;  // Minimum time between progress reports
+    bool hasLimits;
+    ResourceLimits limits;  // Replaces ResourceGovernor's defaults while the context is installed
+
+    CalculationOptions() : hasDeadline(false), progressInterval(100), hasLimits(false) {}
+
+    // Set the deadline relative to now
+    void setTimeout(std::chrono::milliseconds timeout) {
+        hasDeadline = true;
+        deadline = std::chrono::steady_clock::now() + timeout;
+    }
+
+    // Apply resource limits to calculations run under these options
+    void setLimits(const ResourceLimits& newLimits) {
+        hasLimits = true;
+        limits = newLimits;
+    }
+};
+
+/*
+CLASS: CalculationContext
+PURPOSE: Installs CalculationOptions for the current thread while it is in scope, so the inner loops of
+         multiplication, division and square root can poll for cancellation, deadlines and progress
+OPERATIONS: Scoped installation (nests, restoring the outer context; checkpoints poll every enclosing
+            context), static checkpoint(), static currentLimits(), static captureOptions() for worker threads
+LIMITATIONS: With no context installed a checkpoint costs one thread-local load. The progress callback
+             runs on the calculating thread and must not throw anything except CalculationCancelled.
+             A wall-time limit counts from the construction of the context that carries it.
+DATE: 2026-10-19
+*/
+class CalculationContext {
+public:
+    explicit CalculationContext(const CalculationOptions& options);
+    ~CalculationContext();
+
+    CalculationContext(const CalculationContext&) = delete;
+    CalculationContext& operator=(const CalculationContext&) = delete;
+
+    // Called from inner loops; throws CalculationCancelled when the calculation must stop
+    static void checkpoint(CalcOperation op, std::size_t done, std::size_t total) {
+        for (CalculationContext* context = current; context; context = context->previous) {
+            context->poll(op, done, total);
+        }
+    }
+
+    // Copy the limits of the innermost context that carries some; false when none does
+    static bool currentLimits(ResourceLimits& limits);
+
+    // Options of every context installed on this thread, innermost first, for InheritedCalculationContext.
+    // Wall-time limits are reduced by the time already used and progress callbacks are dropped, so
+    // progress is only reported from the thread that installed them.
+    static std::vector<CalculationOptions> captureOptions();
+
+private:
+    CalculationOptions options;
+    CalculationContext* previous;
+    std::chrono::steady_clock::time_point nextProgress;
+    std::chrono::steady_clock::time_point started;
+    bool hasWallTimeLimit;
+
+    static thread_local CalculationContext* current;
+
+    void poll(CalcOperation op, std::size_t done, std::size_t total);
+};
+
+/*
+CLASS: InheritedCalculationContext
+PURPOSE: Installs options captured with CalculationContext::captureOptions() on a worker thread, so work
+         handed to that thread is cancelled, timed out and limited like the thread that started it
+OPERATIONS: Scoped installation of one CalculationContext per captured entry, outermost first
+DATE: 2026-10-19
+*/
+class InheritedCalculationContext {
+public:
+    explicit InheritedCalculationContext(const std::vector<CalculationOptions>& captured);
+    ~InheritedCalculationContext();
+
+    InheritedCalculationContext(const InheritedCalculationContext&) = delete;
+    InheritedCalculationContext& operator=(const InheritedCalculationContext&) = delete;
+
+private:
+    std::vector<std::unique_ptr<CalculationContext> > contexts;  // Outermost first
+};
+
+#endif // CALCULATION_CONTEXT_H
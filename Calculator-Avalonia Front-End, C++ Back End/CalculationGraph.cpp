@@ -0,0 +1,661 @@
+#include "CalculationGraph.h"
+#include "CalculationContext.h"
+#include "ResourceGovernor.h"
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+static const std::size_t NO_CELL = static_cast<std::size_t>(-1);
+
+/*
+STRUCT: FormulaNode
+PURPOSE: Parsed expression tree of a cell; CELL nodes hold the index of the cell they read
+DATE: 2026-10-19
+*/
+struct FormulaNode {
+    enum Kind { NUMBER, CELL, NEGATE, ADD, SUBTRACT, MULTIPLY, DIVIDE, SQRT, ABS, SUM };
+
+    Kind kind;
+    BigNumber number;
+    std::string cellName;
+    std::size_t cell;
+    std::vector<std::unique_ptr<FormulaNode> > operands;
+
+    explicit FormulaNode(Kind kind) : kind(kind), cell(NO_CELL) {}
+};
+
+typedef std::unique_ptr<FormulaNode> NodePointer;
+
+static bool isNameStart(char c) {
+    return std::isalpha(static_cast<unsigned char>(c)) || c == '_';
+}
+
+static bool isNameChar(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+static bool isValidName(const std::string& name) {
+    return !name.empty() && isNameStart(name[0]) && std::all_of(name.begin(), name.end(), isNameChar);
+}
+
+static bool sameValue(const BigNumber& a, const BigNumber& b) {
+    return a.sign() == b.sign() && BigNumber::compareAbsoluteValue(a, b) == 0;
+}
+
+/*
+CLASS: FormulaParser
+PURPOSE: Recursive-descent parser for cell expressions; collects the cell names it meets
+OPERATIONS: parse
+DATE: 2026-10-19
+*/
+class FormulaParser {
+public:
+    FormulaParser(const std::string& text, std::vector<std::string>& references)
+        : text(text), position(0), references(references) {}
+
+    NodePointer parse() {
+        NodePointer node = parseSum();
+        skipSpaces();
+        if (position != text.length()) {
+            fail("Unexpected character");
+        }
+        return node;
+    }
+
+private:
+    const std::string& text;
+    std::size_t position;
+    std::vector<std::string>& references;
+
+    void fail(const std::string& message) const {
+        throw std::invalid_argument(message + " at position " + std::to_string(position) + " in \"" + text + "\"");
+    }
+
+    void skipSpaces() {
+        while (position < text.length() && std::isspace(static_cast<unsigned char>(text[position]))) {
+            position++;
+        }
+    }
+
+    bool accept(char c) {
+        skipSpaces();
+        if (position < text.length() && text[position] == c) {
+            position++;
+            return true;
+        }
+        return false;
+    }
+
+    static NodePointer binary(FormulaNode::Kind kind, NodePointer left, NodePointer right) {
+        NodePointer node(new FormulaNode(kind));
+        node->operands.push_back(std::move(left));
+        node->operands.push_back(std::move(right));
+        return node;
+    }
+
+    // sum := product (('+' | '-') product)*
+    NodePointer parseSum() {
+        NodePointer node = parseProduct();
+        for (;;) {
+            if (accept('+')) {
+                node = binary(FormulaNode::ADD, std::move(node), parseProduct());
+            } else if (accept('-')) {
+                node = binary(FormulaNode::SUBTRACT, std::move(node), parseProduct());
+            } else {
+                return node;
+            }
+        }
+    }
+
+    // product := unary (('*' | '/') unary)*
+    NodePointer parseProduct() {
+        NodePointer node = parseUnary();
+        for (;;) {
+            if (accept('*')) {
+                node = binary(FormulaNode::MULTIPLY, std::move(node), parseUnary());
+            } else if (accept('/')) {
+                node = binary(FormulaNode::DIVIDE, std::move(node), parseUnary());
+            } else {
+                return node;
+            }
+        }
+    }
+
+    // unary := ('-' | '+') unary | primary
+    NodePointer parseUnary() {
+        if (accept('-')) {
+            NodePointer operand = parseUnary();
+            if (operand->kind == FormulaNode::NUMBER) {
+                operand->number = BigNumber() - operand->number;
+                return operand;
+            }
+            NodePointer node(new FormulaNode(FormulaNode::NEGATE));
+            node->operands.push_back(std::move(operand));
+            return node;
+        }
+        if (accept('+')) {
+            return parseUnary();
+        }
+        return parsePrimary();
+    }
+
+    // primary := number | name | name '(' sum (',' sum)* ')' | '(' sum ')'
+    NodePointer parsePrimary() {
+        skipSpaces();
+        if (position == text.length()) {
+            fail("Expression ends early");
+        }
+        char c = text[position];
+        if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+            return parseNumber();
+        }
+        if (accept('(')) {
+            NodePointer node = parseSum();
+            if (!accept(')')) {
+                fail("Expected ')'");
+            }
+            return node;
+        }
+        if (!isNameStart(c)) {
+            fail("Unexpected character");
+        }
+
+        std::size_t start = position;
+        while (position < text.length() && isNameChar(text[position])) {
+            position++;
+        }
+        std::string name = text.substr(start, position - start);
+        if (!accept('(')) {
+            NodePointer node(new FormulaNode(FormulaNode::CELL));
+            node->cellName = name;
+            references.push_back(name);
+            return node;
+        }
+
+        NodePointer node;
+        if (name == "sqrt") {
+            node.reset(new FormulaNode(FormulaNode::SQRT));
+        } else if (name == "abs") {
+            node.reset(new FormulaNode(FormulaNode::ABS));
+        } else if (name == "sum") {
+            node.reset(new FormulaNode(FormulaNode::SUM));
+        } else {
+            position = start;
+            fail("Unknown function " + name);
+        }
+        do {
+            node->operands.push_back(parseSum());
+        } while (accept(','));
+        if (!accept(')')) {
+            fail("Expected ')'");
+        }
+        if (node->kind != FormulaNode::SUM && node->operands.size() != 1) {
+            position = start;
+            fail(name + " takes one argument");
+        }
+        return node;
+    }
+
+    // number := digits ['.' digits] [('e' | 'E') ['+' | '-'] digits]
+    NodePointer parseNumber() {
+        std::size_t start = position;
+        std::size_t mantissaDigits = 0;
+        while (position < text.length() && std::isdigit(static_cast<unsigned char>(text[position]))) {
+            position++;
+            mantissaDigits++;
+        }
+        if (position < text.length() && text[position] == '.') {
+            position++;
+            while (position < text.length() && std::isdigit(static_cast<unsigned char>(text[position]))) {
+                position++;
+                mantissaDigits++;
+            }
+        }
+        if (mantissaDigits == 0) {
+            position = start;
+            fail("Bad number");
+        }
+        if (position < text.length() && (text[position] == 'e' || text[position] == 'E')) {
+            position++;
+            if (position < text.length() && (text[position] == '+' || text[position] == '-')) {
+                position++;
+            }
+            std::size_t exponentStart = position;
+            while (position < text.length() && std::isdigit(static_cast<unsigned char>(text[position]))) {
+                position++;
+            }
+            if (position == exponentStart || position - exponentStart > 9) {
+                position = start;
+                fail("Bad number");
+            }
+        }
+
+        NodePointer node(new FormulaNode(FormulaNode::NUMBER));
+        node->number = BigNumber(text.substr(start, position - start));
+        return node;
+    }
+};
+
+// Point every CELL node at its cell's index
+template <typename Resolve>
+static void resolveCells(FormulaNode& node, Resolve resolve) {
+    if (node.kind == FormulaNode::CELL) {
+        node.cell = resolve(node.cellName);
+    }
+    for (NodePointer& operand : node.operands) {
+        resolveCells(*operand, resolve);
+    }
+}
+
+// ---- CalculationGraph ----
+
+CalculationGraph::CalculationGraph() : dirtyCount(0), lastEvaluatedCount(0) {}
+
+CalculationGraph::~CalculationGraph() {}
+
+std::size_t CalculationGraph::findCell(const std::string& name) const {
+    std::unordered_map<std::string, std::size_t>::const_iterator it = cellIndex.find(name);
+    return it == cellIndex.end() ? NO_CELL : it->second;
+}
+
+std::size_t CalculationGraph::findOrAddCell(const std::string& name) {
+    std::size_t index = findCell(name);
+    if (index != NO_CELL) {
+        return index;
+    }
+    Cell cell;
+    cell.name = name;
+    cell.defined = false;
+    cell.error = "Undefined cell " + name;
+    cell.dirty = false;
+    cell.edited = false;
+    cell.changed = false;
+    cells.push_back(cell);
+    cellIndex[name] = cells.size() - 1;
+    return cells.size() - 1;
+}
+
+const CalculationGraph::Cell& CalculationGraph::definedCell(const std::string& name) const {
+    std::size_t index = findCell(name);
+    if (index == NO_CELL || !cells[index].defined) {
+        throw std::invalid_argument("Undefined cell " + name);
+    }
+    return cells[index];
+}
+
+bool CalculationGraph::dependsOn(std::size_t start, std::size_t target) const {
+    std::vector<bool> visited(cells.size(), false);
+    std::vector<std::size_t> stack(1, start);
+    while (!stack.empty()) {
+        std::size_t index = stack.back();
+        stack.pop_back();
+        if (index == target) {
+            return true;
+        }
+        if (visited[index]) {
+            continue;
+        }
+        visited[index] = true;
+        stack.insert(stack.end(), cells[index].dependencies.begin(), cells[index].dependencies.end());
+    }
+    return false;
+}
+
+// Dependents of a dirty cell are already dirty, so the walk stops at dirty cells
+void CalculationGraph::markDirty(std::size_t index) {
+    std::vector<std::size_t> stack(1, index);
+    while (!stack.empty()) {
+        Cell& cell = cells[stack.back()];
+        stack.pop_back();
+        if (cell.dirty) {
+            continue;
+        }
+        cell.dirty = true;
+        dirtyCount++;
+        stack.insert(stack.end(), cell.dependents.begin(), cell.dependents.end());
+    }
+}
+
+void CalculationGraph::assignCell(std::size_t index, const std::string& expression,
+                                  const std::shared_ptr<const FormulaNode>& formula,
+                                  const std::vector<std::size_t>& dependencies) {
+    for (std::size_t dependency : cells[index].dependencies) {
+        std::vector<std::size_t>& dependents = cells[dependency].dependents;
+        dependents.erase(std::remove(dependents.begin(), dependents.end(), index), dependents.end());
+    }
+    for (std::size_t dependency : dependencies) {
+        cells[dependency].dependents.push_back(index);
+    }
+
+    Cell& cell = cells[index];
+    if (!cell.defined && formula) {
+        definitionOrder.push_back(index);
+    } else if (cell.defined && !formula) {
+        definitionOrder.erase(std::remove(definitionOrder.begin(), definitionOrder.end(), index),
+                              definitionOrder.end());
+    }
+    cell.defined = formula != nullptr;
+    cell.expression = expression;
+    cell.formula = formula;
+    cell.dependencies = dependencies;
+    cell.edited = true;
+    markDirty(index);
+}
+
+void CalculationGraph::setCell(const std::string& name, const std::string& expression) {
+    if (!isValidName(name)) {
+        throw std::invalid_argument("Invalid cell name \"" + name + "\"");
+    }
+    std::size_t self = findCell(name);
+    if (self != NO_CELL && cells[self].defined && cells[self].expression == expression) {
+        return;
+    }
+
+    std::vector<std::string> references;
+    NodePointer formula = FormulaParser(expression, references).parse();
+
+    // Reject a reference back to this cell before anything is changed
+    for (const std::string& reference : references) {
+        std::size_t index = findCell(reference);
+        if (reference == name || (self != NO_CELL && index != NO_CELL && dependsOn(index, self))) {
+            throw std::invalid_argument("Circular reference: " + name + " depends on itself through " + reference);
+        }
+    }
+
+    self = findOrAddCell(name);
+    std::vector<std::size_t> dependencies;
+    resolveCells(*formula, [this, &dependencies](const std::string& reference) {
+        std::size_t index = findOrAddCell(reference);
+        if (std::find(dependencies.begin(), dependencies.end(), index) == dependencies.end()) {
+            dependencies.push_back(index);
+        }
+        return index;
+    });
+    assignCell(self, expression, std::shared_ptr<const FormulaNode>(formula.release()), dependencies);
+}
+
+void CalculationGraph::setValue(const std::string& name, const BigNumber& value) {
+    if (!isValidName(name)) {
+        throw std::invalid_argument("Invalid cell name \"" + name + "\"");
+    }
+    std::size_t self = findOrAddCell(name);
+    const Cell& cell = cells[self];
+    if (cell.defined && cell.formula->kind == FormulaNode::NUMBER && sameValue(cell.formula->number, value)) {
+        return;
+    }
+
+    std::shared_ptr<FormulaNode> formula = std::make_shared<FormulaNode>(FormulaNode::NUMBER);
+    formula->number = value;
+    assignCell(self, value.toString(), formula, std::vector<std::size_t>());
+}
+
+void CalculationGraph::removeCell(const std::string& name) {
+    std::size_t index = findCell(name);
+    if (index != NO_CELL && cells[index].defined) {
+        assignCell(index, std::string(), std::shared_ptr<const FormulaNode>(), std::vector<std::size_t>());
+    }
+}
+
+bool CalculationGraph::hasCell(const std::string& name) const {
+    std::size_t index = findCell(name);
+    return index != NO_CELL && cells[index].defined;
+}
+
+std::vector<std::string> CalculationGraph::getCellNames() const {
+    std::vector<std::string> names;
+    for (std::size_t index : definitionOrder) {
+        names.push_back(cells[index].name);
+    }
+    return names;
+}
+
+std::string CalculationGraph::getExpression(const std::string& name) const {
+    return definedCell(name).expression;
+}
+
+std::vector<std::string> CalculationGraph::getDependencies(const std::string& name) const {
+    std::vector<std::string> names;
+    for (std::size_t index : definedCell(name).dependencies) {
+        names.push_back(cells[index].name);
+    }
+    return names;
+}
+
+std::vector<std::string> CalculationGraph::getDependents(const std::string& name) const {
+    std::vector<std::string> names;
+    for (std::size_t index : definedCell(name).dependents) {
+        names.push_back(cells[index].name);
+    }
+    return names;
+}
+
+BigNumber CalculationGraph::getValue(const std::string& name) {
+    if (dirtyCount != 0) {
+        recalculate();
+    }
+    const Cell& cell = definedCell(name);
+    if (!cell.error.empty()) {
+        throw std::invalid_argument(cell.error);
+    }
+    return cell.value;
+}
+
+std::string CalculationGraph::getString(const std::string& name) {
+    return getValue(name).toString();
+}
+
+BigNumber CalculationGraph::evaluateNode(const FormulaNode& node) const {
+    switch (node.kind) {
+    case FormulaNode::NUMBER:
+        return node.number;
+    case FormulaNode::CELL:
+        return cells[node.cell].value;
+    case FormulaNode::NEGATE:
+        return BigNumber() - evaluateNode(*node.operands[0]);
+    case FormulaNode::ABS:
+        return evaluateNode(*node.operands[0]).abs();
+    case FormulaNode::SQRT: {
+        BigNumber a = evaluateNode(*node.operands[0]);
+        ResourceGovernor::admitSqrt(a);
+        return a.sqrt();
+    }
+    case FormulaNode::SUM: {
+        std::vector<BigNumber> values;
+        for (const NodePointer& operand : node.operands) {
+            values.push_back(evaluateNode(*operand));
+        }
+        ResourceGovernor::admitSum(values);
+        BigNumber total;
+        for (const BigNumber& value : values) {
+            total = total + value;
+        }
+        return total;
+    }
+    default:
+        break;
+    }
+
+    BigNumber a = evaluateNode(*node.operands[0]);
+    BigNumber b = evaluateNode(*node.operands[1]);
+    switch (node.kind) {
+    case FormulaNode::ADD:
+        ResourceGovernor::admitAdd(a, b);
+        return a + b;
+    case FormulaNode::SUBTRACT:
+        ResourceGovernor::admitAdd(a, b);
+        return a - b;
+    case FormulaNode::MULTIPLY:
+        ResourceGovernor::admitMultiply(a, b);
+        return a * b;
+    default:
+        if (b.isZero()) {
+            throw std::invalid_argument("Division by zero");
+        }
+        ResourceGovernor::admitDivide(a, b);
+        return a / b;
+    }
+}
+
+bool CalculationGraph::evaluateCell(std::size_t index) {
+    Cell& cell = cells[index];
+    cell.dirty = false;
+
+    // Nothing this cell reads has a new value: keep the old one
+    bool needed = cell.edited;
+    for (std::size_t dependency : cell.dependencies) {
+        needed = needed || cells[dependency].changed;
+    }
+    if (!needed) {
+        cell.changed = false;
+        return false;
+    }
+    cell.edited = false;
+
+    BigNumber value;
+    std::string error;
+    if (!cell.defined) {
+        error = "Undefined cell " + cell.name;
+    } else {
+        // An error in a cell this one reads is passed on unchanged
+        for (std::size_t dependency : cell.dependencies) {
+            if (!cells[dependency].error.empty()) {
+                error = cells[dependency].error;
+                break;
+            }
+        }
+        if (error.empty()) {
+            try {
+                value = evaluateNode(*cell.formula);
+            } catch (const CalculationCancelled&) {
+                // Says nothing about the cell: leave it dirty and forced for the next recalculation
+                cell.dirty = true;
+                cell.edited = true;
+                throw;
+            } catch (const ResourceLimitExceeded&) {
+                // Depends on the limits in force, not the formula: keep the cell dirty like a cancellation
+                cell.dirty = true;
+                cell.edited = true;
+                throw;
+            } catch (const std::exception& e) {
+                error = std::string(e.what()) + " in cell " + cell.name;
+            }
+        }
+    }
+
+    cell.changed = error != cell.error || (error.empty() && !sameValue(value, cell.value));
+    if (cell.changed) {
+        cell.value = value;
+        cell.error = error;
+    }
+    return true;
+}
+
+void CalculationGraph::recalculate(unsigned threadCount) {
+    lastEvaluatedCount = 0;
+    if (dirtyCount == 0) {
+        return;
+    }
+
+    // Each dirty cell waits for the dirty cells it reads
+    std::vector<std::size_t> pending(cells.size(), 0);
+    std::deque<std::size_t> ready;
+    for (std::size_t i = 0; i < cells.size(); i++) {
+        cells[i].changed = false;
+        if (!cells[i].dirty) {
+            continue;
+        }
+        for (std::size_t dependency : cells[i].dependencies) {
+            if (cells[dependency].dirty) {
+                pending[i]++;
+            }
+        }
+        if (pending[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0) {
+            threadCount = 2;
+        }
+    }
+    threadCount = static_cast<unsigned>(std::min<std::size_t>(threadCount, dirtyCount));
+
+    std::mutex mutex;
+    std::condition_variable available;
+    std::size_t remaining = dirtyCount;
+    std::size_t evaluated = 0;
+    std::exception_ptr failure;  // First cancellation or limit error; stops every thread
+
+    // Take a ready cell, evaluate it outside the lock, then release the dependents it was holding back
+    auto work = [this, &mutex, &available, &ready, &remaining, &evaluated, &pending, &failure]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            available.wait(lock, [&ready, &remaining, &failure]() {
+                return !ready.empty() || remaining == 0 || failure;
+            });
+            if (remaining == 0 || failure) {
+                return;
+            }
+            std::size_t index = ready.front();
+            ready.pop_front();
+            lock.unlock();
+            bool ran;
+            try {
+                ran = evaluateCell(index);
+            } catch (...) {
+                lock.lock();
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+                available.notify_all();
+                return;
+            }
+            lock.lock();
+
+            evaluated += ran ? 1 : 0;
+            remaining--;
+            for (std::size_t dependent : cells[index].dependents) {
+                if (cells[dependent].dirty && --pending[dependent] == 0) {
+                    ready.push_back(dependent);
+                }
+            }
+            available.notify_all();
+        }
+    };
+
+    // Workers are cancelled, timed out and limited like the calling thread
+    std::vector<CalculationOptions> inherited = CalculationContext::captureOptions();
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < threadCount; i++) {
+        workers.push_back(std::thread([&work, &inherited]() {
+            InheritedCalculationContext context(inherited);
+            work();
+        }));
+    }
+    work();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    lastEvaluatedCount = evaluated;
+    if (failure) {
+        // Cells evaluated before the stop keep their new values. The rest stay dirty and are forced,
+        // since the changes that made them dirty are no longer flagged on the cells they read.
+        dirtyCount = 0;
+        for (Cell& cell : cells) {
+            if (cell.dirty) {
+                cell.edited = true;
+                dirtyCount++;
+            }
+        }
+        std::rethrow_exception(failure);
+    }
+    dirtyCount = 0;
+}
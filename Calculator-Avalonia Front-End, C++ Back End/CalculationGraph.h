@@ -0,0 +1,146 @@
+#ifndef CALCULATION_GRAPH_H
+#define CALCULATION_GRAPH_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "BigNumber.h"
+
+struct FormulaNode;
+
+/*
+CLASS: CalculationGraph
+PURPOSE: Spreadsheet-style set of named cells. Each cell holds an expression over numbers and other
+         cells ("price * (1 + rate)"); the graph keeps the value of every cell and the edges between
+         them. Changing a cell marks only its dependents dirty. recalculate() evaluates the dirty cells
+         in dependency order, running independent cells on separate threads, and a cell whose new value
+         equals its old one stops the update there: its dependents keep their values.
+OPERATIONS: setCell (expression text), setValue (a BigNumber), removeCell, getValue/getString,
+            recalculate, dependency queries, count of cells evaluated by the last recalculation
+LIMITATIONS: Expressions use + - * /, unary minus, parentheses, numbers (1.5, 2e10) and the functions
+             sqrt(x), abs(x) and sum(x, ...). / and sqrt truncate like BigNumber: 20 digits after the
+             point, or 20 significant digits for results below one, however the operands are written.
+             Names start with a letter or '_' and are case-sensitive. Circular references are rejected
+             when the cell is set. A cell whose expression fails (division by zero, an undefined cell)
+             keeps the error and getValue throws it; cancellations and resource limits are not errors
+             of the cell. The graph itself is not thread-safe: call it from one thread at a time.
+DATE: 2026-10-19
+*/
+class CalculationGraph {
+public:
+    CalculationGraph();
+    ~CalculationGraph();
+
+    CalculationGraph(const CalculationGraph&) = delete;
+    CalculationGraph& operator=(const CalculationGraph&) = delete;
+
+    /*
+    FUNCTION: Defines or replaces a cell's expression
+    INPUT: Cell name and expression text (a constant such as "12.5" makes an input cell)
+    OUTPUT: None; the cell and its dependents are marked dirty
+    SCALE: O(expression length) to parse, plus the cells reachable from the new references
+    LIMITATIONS: Throws std::invalid_argument for a bad name, a syntax error or a circular reference;
+                 the cell is left unchanged in that case
+    DATE: 2026-10-19
+    */
+    void setCell(const std::string& name, const std::string& expression);
+
+    // Set a cell to a fixed value; nothing is marked dirty when the value is unchanged
+    void setValue(const std::string& name, const BigNumber& value);
+
+    // Remove a cell; cells that still reference it report it as undefined
+    void removeCell(const std::string& name);
+
+    // Check if a cell is defined
+    bool hasCell(const std::string& name) const;
+
+    // Names of the defined cells, in the order they were first defined
+    std::vector<std::string> getCellNames() const;
+
+    // Expression text of a cell (the value's text for cells set with setValue)
+    std::string getExpression(const std::string& name) const;
+
+    // Cells the given cell reads, and cells that read it
+    std::vector<std::string> getDependencies(const std::string& name) const;
+    std::vector<std::string> getDependents(const std::string& name) const;
+
+    /*
+    FUNCTION: Returns the value of a cell, recalculating dirty cells first
+    INPUT: Cell name
+    OUTPUT: The cell's value
+    SCALE: O(1) when nothing is dirty
+    LIMITATIONS: Throws std::invalid_argument for an undefined cell or when the cell's expression
+                 failed (the message names the error)
+    DATE: 2026-10-19
+    */
+    BigNumber getValue(const std::string& name);
+
+    // getValue as a string
+    std::string getString(const std::string& name);
+
+    /*
+    FUNCTION: Evaluates every dirty cell
+    INPUT: Thread count (0 means one per hardware thread)
+    OUTPUT: None; values and errors are stored in the cells
+    SCALE: Each dirty cell is evaluated at most once, after the dirty cells it reads. A cell is only
+           evaluated when its expression changed or a cell it reads got a different value. Threads take
+           whichever cells are ready, so independent branches run side by side.
+    LIMITATIONS: Each operation is checked against the resource limits of the calling thread's
+                 CalculationContext (or the defaults), and worker threads poll its cancellation token
+                 and deadline. A cancellation or limit error stops the recalculation and is rethrown:
+                 cells already evaluated keep their new values, the rest stay dirty for the next call
+    DATE: 2026-10-19
+    */
+    void recalculate(unsigned threadCount = 0);
+
+    // Check if any cell is waiting for recalculation
+    bool isDirty() const { return dirtyCount != 0; }
+
+    // Number of cells whose expression the last recalculation evaluated
+    std::size_t getLastEvaluatedCount() const { return lastEvaluatedCount; }
+
+private:
+    struct Cell {
+        std::string name;
+        bool defined;
+        std::string expression;
+        std::shared_ptr<const FormulaNode> formula;
+        std::vector<std::size_t> dependencies;  // Cells the formula reads (unique)
+        std::vector<std::size_t> dependents;    // Cells whose formula reads this one
+        BigNumber value;
+        std::string error;   // Empty when value is valid
+        bool dirty;          // Waiting for recalculation
+        bool edited;         // Expression changed since the last evaluation
+        bool changed;        // Value or error changed during the current recalculation
+    };
+
+    // Index of a cell, creating an undefined placeholder when asked to
+    std::size_t findCell(const std::string& name) const;
+    std::size_t findOrAddCell(const std::string& name);
+
+    // Replace a cell's formula and dependency edges, then mark it and its dependents dirty
+    void assignCell(std::size_t index, const std::string& expression, const std::shared_ptr<const FormulaNode>& formula,
+                    const std::vector<std::size_t>& dependencies);
+
+    // Check if target can be reached from start by following dependencies
+    bool dependsOn(std::size_t start, std::size_t target) const;
+
+    void markDirty(std::size_t index);
+
+    // Evaluate one dirty cell whose dirty dependencies are done; returns true if its formula ran
+    bool evaluateCell(std::size_t index);
+
+    BigNumber evaluateNode(const FormulaNode& node) const;
+
+    const Cell& definedCell(const std::string& name) const;
+
+    std::vector<Cell> cells;
+    std::unordered_map<std::string, std::size_t> cellIndex;
+    std::vector<std::size_t> definitionOrder;
+    std::size_t dirtyCount;
+    std::size_t lastEvaluatedCount;
+};
+
+#endif // CALCULATION_GRAPH_H
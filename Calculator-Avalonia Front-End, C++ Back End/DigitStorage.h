@@ -0,0 +1,78 @@
+#ifndef DIGIT_STORAGE_H
+#define DIGIT_STORAGE_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+/*
+CLASS: DigitStorage
+PURPOSE: Reference-counted, copy-on-write digit string for BigNumber. Copies share one buffer, so copying
+         a BigNumber is O(1) however many digits it holds; the buffer is cloned only when a value that
+         shares it is modified through mutate().
+OPERATIONS: Read-only std::string access (implicit conversion, length, indexing, find, compare),
+            assignment from a std::string (moved in without copying), mutate() for in-place edits
+LIMITATIONS: The reference count is atomic, so values sharing a buffer may be copied and read on different
+             threads. As with std::string, one DigitStorage object must not be modified while another
+             thread uses that same object. References returned by mutate() are invalidated by copies.
+DATE: 2026-10-19
+*/
+class DigitStorage {
+public:
+    // Default constructor - shares the process-wide "0" buffer
+    DigitStorage() : data(zero()) {}
+
+    // Take ownership of a digit string
+    DigitStorage(std::string digits) : data(std::make_shared<std::string>(std::move(digits))) {}
+    DigitStorage(const char* digits) : data(std::make_shared<std::string>(digits)) {}
+
+    // Replace the digits with a new buffer (other values sharing the old one are unaffected)
+    DigitStorage& operator=(std::string digits) {
+        data = std::make_shared<std::string>(std::move(digits));
+        return *this;
+    }
+    DigitStorage& operator=(const char* digits) {
+        data = std::make_shared<std::string>(digits);
+        return *this;
+    }
+
+    // Read-only access to the digits
+    const std::string& str() const { return *data; }
+    operator const std::string&() const { return *data; }
+
+    std::size_t length() const { return data->length(); }
+    std::size_t size() const { return data->size(); }
+    bool empty() const { return data->empty(); }
+    char operator[](std::size_t index) const { return (*data)[index]; }
+
+    std::size_t find_first_not_of(char c, std::size_t pos = 0) const { return data->find_first_not_of(c, pos); }
+    std::string substr(std::size_t pos = 0, std::size_t count = std::string::npos) const {
+        return data->substr(pos, count);
+    }
+
+    bool operator==(const char* other) const { return *data == other; }
+    bool operator!=(const char* other) const { return *data != other; }
+
+    // Writable access; clones the buffer first if any other value shares it
+    std::string& mutate() {
+        if (data.use_count() != 1) {
+            data = std::make_shared<std::string>(*data);
+        }
+        return *data;
+    }
+
+    // Check whether this value is the only owner of its buffer
+    bool unique() const { return data.use_count() == 1; }
+
+private:
+    std::shared_ptr<std::string> data;
+
+    // Shared buffer for zero, so default-constructed values never allocate
+    static const std::shared_ptr<std::string>& zero() {
+        static const std::shared_ptr<std::string> buffer = std::make_shared<std::string>("0");
+        return buffer;
+    }
+};
+
+#endif // DIGIT_STORAGE_H
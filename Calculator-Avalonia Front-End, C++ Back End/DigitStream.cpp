@@ -0,0 +1,211 @@
+#include "DigitStream.h"
+#include "CalculationContext.h"
+#include "DigitStrings.h"
+#include <climits>
+#include <stdexcept>
+
+DigitGenerator::DigitGenerator(bool negative, long long firstPosition)
+    : negative(negative), position(firstPosition), lowestPosition(LLONG_MIN), started(false),
+      wroteDigit(false), wrotePoint(false), done(false) {}
+
+// Stop after the given number of digits past the decimal point
+void DigitGenerator::setFractionDigits(std::size_t fractionDigits) {
+    lowestPosition = -static_cast<long long>(fractionDigits);
+}
+
+// Replace chunk with the next (at most chunkSize) characters; returns false once nothing is left
+bool DigitGenerator::nextChunk(std::string& chunk, std::size_t chunkSize) {
+    if (chunkSize == 0) {
+        chunkSize = 1;
+    }
+    while (pending.length() < chunkSize && !done) {
+        produce();
+    }
+    chunk.assign(pending, 0, chunkSize);
+    pending.erase(0, chunk.length());
+    return !chunk.empty();
+}
+
+// Pass successive chunks to callback until the output ends or callback returns false
+void DigitGenerator::stream(std::size_t chunkSize, const std::function<bool(const std::string&)>& callback) {
+    std::string chunk;
+    while (nextChunk(chunk, chunkSize)) {
+        if (!callback(chunk)) {
+            return;
+        }
+    }
+}
+
+// True once every character has been produced
+bool DigitGenerator::finished() const {
+    return done && pending.empty();
+}
+
+// Append the characters for one more digit to pending
+void DigitGenerator::produce() {
+    if (!started) {
+        started = true;
+        if (negative) {
+            pending += '-';
+        }
+        // Results below one start with "0." and the zeros above the first digit, stopping at the
+        // precision limit so a result that truncates to zero looks like any other truncated one
+        if (position < 0) {
+            pending += '0';
+            wroteDigit = true;
+            if (lowestPosition < 0) {
+                long long zeros = position < lowestPosition ? -lowestPosition : -position - 1;
+                pending += '.';
+                pending.append(static_cast<std::size_t>(zeros), '0');
+                wrotePoint = true;
+            }
+        }
+    }
+
+    if (position < lowestPosition) {
+        // Precision reached
+        done = true;
+        return;
+    }
+
+    int digit = nextDigit();
+    if (digit < 0) {
+        // The rest of the expansion is zero: fill the integer part and stop
+        if (position >= 0) {
+            pending.append(wroteDigit ? static_cast<std::size_t>(position + 1) : 1, '0');
+        }
+        done = true;
+        return;
+    }
+
+    // Leading zeros above the units digit are not written
+    if (digit == 0 && !wroteDigit && position > 0) {
+        position--;
+        return;
+    }
+
+    if (position == -1 && !wrotePoint) {
+        pending += '.';
+        wrotePoint = true;
+    }
+    pending += static_cast<char>('0' + digit);
+    wroteDigit = true;
+    position--;
+}
+
+// Compute the position of the first quotient digit: bringing down dividend digit i gives the digit
+// of weight 10^(len - 1 - i + dividendExponent - divisorExponent)
+QuotientDigitGenerator::QuotientDigitGenerator(const BigNumber& dividend, const BigNumber& divisor)
+    : DigitGenerator(dividend.isNegative != divisor.isNegative && !dividend.isZero(),
+                     static_cast<long long>(dividend.digits.length()) - 1 +
+                         dividend.exponent - divisor.exponent),
+      dividendDigits(dividend.isZero() ? std::string() : dividend.digits.str()),
+      multiples(10),
+      index(0) {
+    if (divisor.isZero()) {
+        throw std::invalid_argument("Division by zero");
+    }
+    for (int k = 1; k < 10; k++) {
+        multiples[k] = multiplyDigitStringByDigit(divisor.digits, k);
+    }
+}
+
+// Bring down the next dividend digit (zeros once the dividend is used up) and divide
+int QuotientDigitGenerator::nextDigit() {
+    if (remainder.empty() && index >= dividendDigits.length()) {
+        return -1;
+    }
+    CalculationContext::checkpoint(OP_DIVIDE, index, 0);
+
+    char next = index < dividendDigits.length() ? dividendDigits[index] : '0';
+    index++;
+    if (!remainder.empty() || next != '0') {
+        remainder += next;
+    }
+
+    int digit = 9;
+    while (digit > 0 && compareDigitStrings(multiples[digit], remainder) > 0) {
+        digit--;
+    }
+    if (digit > 0) {
+        subtractDigitStrings(remainder, multiples[digit]);
+    }
+    return digit;
+}
+
+// Radicand digits scaled so the exponent is even and padded to whole pairs:
+// sqrt(d * 10^(2h + r)) = sqrt(d * 10^r) * 10^h
+std::string SqrtDigitGenerator::radicandPairs(const BigNumber& radicand, long long& h) {
+    long long r = ((radicand.exponent % 2) + 2) % 2;
+    h = (radicand.exponent - r) / 2;
+    std::string pairs = radicand.digits;
+    pairs.append(static_cast<std::size_t>(r), '0');
+    if (pairs.length() % 2 != 0) {
+        pairs.insert(0, 1, '0');
+    }
+    return pairs;
+}
+
+SqrtDigitGenerator::SqrtDigitGenerator(const BigNumber& radicand)
+    : DigitGenerator(false, firstPosition(radicand)), index(0), produced(0) {
+    if (radicand.isNegative && !radicand.isZero()) {
+        throw std::invalid_argument("Cannot compute square root of negative number");
+    }
+    if (!radicand.isZero()) {
+        long long h;
+        radicandDigits = radicandPairs(radicand, h);
+    }
+}
+
+// Each pair brought down yields one root digit, so the first has weight 10^(pairs - 1 + h)
+long long SqrtDigitGenerator::firstPosition(const BigNumber& radicand) {
+    if (radicand.isZero()) {
+        return 0;
+    }
+    long long h;
+    std::string pairs = radicandPairs(radicand, h);
+    return static_cast<long long>(pairs.length() / 2) - 1 + h;
+}
+
+// Bring down the next pair and find the largest digit d with (20 * root + d) * d <= remainder
+int SqrtDigitGenerator::nextDigit() {
+    if (remainder.empty() && index >= radicandDigits.length()) {
+        return -1;
+    }
+    CalculationContext::checkpoint(OP_SQRT, produced++, 0);
+
+    for (int k = 0; k < 2; k++) {
+        char next = index < radicandDigits.length() ? radicandDigits[index] : '0';
+        index++;
+        if (!remainder.empty() || next != '0') {
+            remainder += next;
+        }
+    }
+
+    // 20 * root ends in zero, so 20 * root + d replaces that zero with d
+    std::string trial = multiplyDigitStringByDigit(root, 2);
+    if (!trial.empty()) {
+        trial += '0';
+    }
+    int digit = 9;
+    std::string product;
+    for (; digit > 0; digit--) {
+        std::string candidate = trial;
+        if (candidate.empty()) {
+            candidate = std::string(1, static_cast<char>('0' + digit));
+        } else {
+            candidate[candidate.length() - 1] = static_cast<char>('0' + digit);
+        }
+        product = multiplyDigitStringByDigit(candidate, digit);
+        if (compareDigitStrings(product, remainder) <= 0) {
+            break;
+        }
+    }
+    if (digit > 0) {
+        subtractDigitStrings(remainder, product);
+    }
+    if (!root.empty() || digit != 0) {
+        root += static_cast<char>('0' + digit);
+    }
+    return digit;
+}
@@ -0,0 +1,112 @@
+#ifndef DIGIT_STREAM_H
+#define DIGIT_STREAM_H
+
+#include "BigNumber.h"
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+CLASS: DigitGenerator
+PURPOSE: Produces the decimal expansion of a result most significant digit first, so callers can show
+         the leading digits of a long division or square root while the rest is still being computed
+OPERATIONS: nextChunk() pulls the next formatted characters; stream() pushes chunks to a callback
+            until the result is exhausted, the precision limit is reached or the callback returns false
+LIMITATIONS: Output is truncated, never rounded. Non-terminating expansions continue until the
+             precision limit or the caller stops; a truncated result always has exactly the requested
+             number of digits after the point. A negative sign is written before the first digit, so a
+             negative result truncated to zero is written as "-0.00" (two fraction digits) or "-0" (none).
+DATE: 2026-10-19
+*/
+class DigitGenerator {
+public:
+    virtual ~DigitGenerator() {}
+
+    // Stop after the given number of digits past the decimal point
+    void setFractionDigits(std::size_t fractionDigits);
+
+    // Replace chunk with the next (at most chunkSize) characters; returns false once nothing is left
+    bool nextChunk(std::string& chunk, std::size_t chunkSize);
+
+    // Pass successive chunks to callback until the output ends or callback returns false
+    void stream(std::size_t chunkSize, const std::function<bool(const std::string&)>& callback);
+
+    // True once every character has been produced
+    bool finished() const;
+
+protected:
+    // firstPosition is the power of ten of the first digit nextDigit() returns
+    DigitGenerator(bool negative, long long firstPosition);
+
+    // Next digit (0-9), or -1 once every remaining digit is zero
+    virtual int nextDigit() = 0;
+
+private:
+    bool negative;           // Write a sign before the first digit
+    long long position;      // Power of ten of the next digit
+    long long lowestPosition;  // Last position written when a precision limit is set
+    bool started;            // Sign and leading "0." have been written
+    bool wroteDigit;         // A significant (or units) digit has been written
+    bool wrotePoint;         // The decimal point has been written
+    bool done;               // No more characters will be produced
+    std::string pending;     // Characters produced but not yet handed out
+
+    // Append the characters for one more digit to pending
+    void produce();
+};
+
+/*
+CLASS: QuotientDigitGenerator
+PURPOSE: Streams the digits of dividend / divisor by schoolbook long division, one quotient digit
+         per step with the remainder carried between steps
+OPERATIONS: See DigitGenerator
+LIMITATIONS: Throws std::invalid_argument for a zero divisor. Each digit costs O(m) for an
+             m-digit divisor; polls CalculationContext once per digit.
+DATE: 2026-10-19
+*/
+class QuotientDigitGenerator : public DigitGenerator {
+public:
+    QuotientDigitGenerator(const BigNumber& dividend, const BigNumber& divisor);
+
+protected:
+    int nextDigit();
+
+private:
+    std::string dividendDigits;
+    std::vector<std::string> multiples;  // divisor * 0 .. divisor * 9
+    std::string remainder;
+    std::size_t index;                   // Next dividend digit to bring down
+};
+
+/*
+CLASS: SqrtDigitGenerator
+PURPOSE: Streams the digits of a square root with the digit-by-digit (pairwise) method,
+         one root digit per pair of radicand digits
+OPERATIONS: See DigitGenerator
+LIMITATIONS: Throws std::invalid_argument for a negative radicand. Each digit costs O(k) for a root
+             of k digits so far, so n digits cost O(n^2) in total; polls CalculationContext once per digit.
+DATE: 2026-10-19
+*/
+class SqrtDigitGenerator : public DigitGenerator {
+public:
+    explicit SqrtDigitGenerator(const BigNumber& radicand);
+
+protected:
+    int nextDigit();
+
+private:
+    std::string radicandDigits;  // Even number of digits, grouped in pairs from the left
+    std::string root;
+    std::string remainder;
+    std::size_t index;           // Next pair to bring down
+    std::size_t produced;        // Digits produced so far (progress reporting)
+
+    // Radicand digits scaled to an even exponent 2h and padded to whole pairs
+    static std::string radicandPairs(const BigNumber& radicand, long long& h);
+
+    // Power of ten of the first root digit
+    static long long firstPosition(const BigNumber& radicand);
+};
+
+#endif // DIGIT_STREAM_H
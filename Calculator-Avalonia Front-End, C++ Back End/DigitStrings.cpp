@@ -0,0 +1,152 @@
+#include "DigitStrings.h"
+#include "CalculationContext.h"
+
+// Compare two non-negative integer digit strings without leading zeros ("" is zero)
+int compareDigitStrings(const std::string& a, const std::string& b) {
+    if (a.length() != b.length()) {
+        return a.length() > b.length() ? 1 : -1;
+    }
+    return a.compare(b);
+}
+
+// a -= b for integer digit strings without leading zeros (requires a >= b); strips leading zeros
+void subtractDigitStrings(std::string& a, const std::string& b) {
+    int borrow = 0;
+    size_t i = a.length();
+    for (size_t k = b.length(); k-- > 0;) {
+        i--;
+        int diff = (a[i] - '0') - (b[k] - '0') - borrow;
+        borrow = diff < 0 ? 1 : 0;
+        a[i] = static_cast<char>('0' + diff + 10 * borrow);
+    }
+    while (borrow > 0) {
+        i--;
+        int diff = (a[i] - '0') - borrow;
+        borrow = diff < 0 ? 1 : 0;
+        a[i] = static_cast<char>('0' + diff + 10 * borrow);
+    }
+    
+    size_t firstNonZero = a.find_first_not_of('0');
+    a.erase(0, firstNonZero == std::string::npos ? a.length() : firstNonZero);
+}
+
+// a + b for integer digit strings without leading zeros ("" is zero)
+std::string addDigitStrings(const std::string& a, const std::string& b) {
+    const std::string& longer = a.length() >= b.length() ? a : b;
+    const std::string& shorter = a.length() >= b.length() ? b : a;
+    
+    std::string sum(longer.length() + 1, '0');
+    sum.replace(1, longer.length(), longer);
+    
+    int carry = 0;
+    size_t i = sum.length();
+    for (size_t k = shorter.length(); k-- > 0;) {
+        i--;
+        int digit = (sum[i] - '0') + (shorter[k] - '0') + carry;
+        carry = digit >= 10 ? 1 : 0;
+        sum[i] = static_cast<char>('0' + digit - 10 * carry);
+    }
+    while (carry > 0) {
+        i--;
+        int digit = (sum[i] - '0') + carry;
+        carry = digit >= 10 ? 1 : 0;
+        sum[i] = static_cast<char>('0' + digit - 10 * carry);
+    }
+    
+    if (sum[0] == '0') {
+        sum.erase(0, 1);
+    }
+    return sum;
+}
+
+// floor(n * 10^shift): zeros appended, or the lowest -shift digits dropped
+std::string scaleDigitString(const std::string& n, long long shift) {
+    if (shift < 0) {
+        long long keep = static_cast<long long>(n.length()) + shift;
+        return keep > 0 ? n.substr(0, static_cast<std::size_t>(keep)) : std::string();
+    }
+    std::string scaled;
+    scaled.reserve(n.length() + static_cast<std::size_t>(shift));
+    scaled += n;
+    scaled.append(static_cast<std::size_t>(shift), '0');
+    return scaled;
+}
+
+// Floor of dividend / divisor for integer digit strings without leading zeros (divisor non-zero)
+std::string divideDigitStrings(const std::string& dividend, const std::string& divisor) {
+    // Multiples of the divisor (0x..9x) pick each quotient digit with at most nine comparisons
+    std::string multiples[10];
+    for (int k = 1; k <= 9; k++) {
+        multiples[k] = addDigitStrings(multiples[k - 1], divisor);
+    }
+    
+    // Long division: bring down one digit at a time; the remainder never has leading zeros
+    std::string quotient;
+    quotient.reserve(dividend.length());
+    std::string remainder;
+    
+    for (size_t i = 0; i < dividend.length(); i++) {
+        CalculationContext::checkpoint(OP_DIVIDE, i, dividend.length());
+        
+        if (!remainder.empty() || dividend[i] != '0') {
+            remainder.push_back(dividend[i]);
+        }
+        
+        int quotientDigit = 9;
+        while (quotientDigit > 0 && compareDigitStrings(multiples[quotientDigit], remainder) > 0) {
+            quotientDigit--;
+        }
+        if (quotientDigit > 0) {
+            subtractDigitStrings(remainder, multiples[quotientDigit]);
+        }
+        if (!quotient.empty() || quotientDigit > 0) {
+            quotient.push_back(static_cast<char>('0' + quotientDigit));
+        }
+    }
+    
+    return quotient;
+}
+
+// a * digit for an integer digit string without leading zeros and a single digit 0-9
+std::string multiplyDigitStringByDigit(const std::string& a, int digit) {
+    if (digit == 0 || a.empty()) {
+        return std::string();
+    }
+    
+    std::string product(a.length() + 1, '0');
+    int carry = 0;
+    for (size_t k = a.length(); k-- > 0;) {
+        int value = (a[k] - '0') * digit + carry;
+        carry = value / 10;
+        product[k + 1] = static_cast<char>('0' + value % 10);
+    }
+    product[0] = static_cast<char>('0' + carry);
+    
+    if (product[0] == '0') {
+        product.erase(0, 1);
+    }
+    return product;
+}
+
+// Floor of the square root of an integer digit string without leading zeros (Newton's method)
+std::string sqrtDigitStrings(const std::string& n) {
+    if (n.empty()) {
+        return n;
+    }
+    
+    // Initial guess 10^ceil(len/2) is at or above the root, so the iteration decreases monotonically
+    std::string guess = "1";
+    guess.append((n.length() + 1) / 2, '0');
+    
+    // x_next = floor((x + floor(n/x)) / 2) until it stops decreasing
+    for (size_t iteration = 0; ; iteration++) {
+        CalculationContext::checkpoint(OP_SQRT, iteration, 0);
+        
+        std::string sum = addDigitStrings(guess, divideDigitStrings(n, guess));
+        std::string next = divideDigitStrings(sum, "2");
+        if (compareDigitStrings(next, guess) >= 0) {
+            return guess;
+        }
+        guess.swap(next);
+    }
+}
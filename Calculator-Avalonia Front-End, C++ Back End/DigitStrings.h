@@ -0,0 +1,81 @@
+#ifndef DIGIT_STRINGS_H
+#define DIGIT_STRINGS_H
+
+#include <string>
+
+/*
+Integer kernels on decimal digit strings, shared by BigNumber and the digit generators.
+Every operand is a non-negative integer written without leading zeros; the empty string is zero.
+*/
+
+/*
+FUNCTION: Compares two digit strings
+INPUT: Two digit strings
+OUTPUT: int (negative, zero or positive as a is less than, equal to or greater than b)
+SCALE: O(n)
+LIMITATIONS: Operands must not have leading zeros
+DATE: 2026-10-19
+*/
+int compareDigitStrings(const std::string& a, const std::string& b);
+
+/*
+FUNCTION: Subtracts b from a in place
+INPUT: Digit strings a and b with a >= b
+OUTPUT: void (a holds a - b without leading zeros)
+SCALE: O(n)
+LIMITATIONS: Behavior is undefined when a < b
+DATE: 2026-10-19
+*/
+void subtractDigitStrings(std::string& a, const std::string& b);
+
+/*
+FUNCTION: Adds two digit strings
+INPUT: Two digit strings
+OUTPUT: std::string containing a + b
+SCALE: O(n)
+LIMITATIONS: None
+DATE: 2026-10-19
+*/
+std::string addDigitStrings(const std::string& a, const std::string& b);
+
+/*
+FUNCTION: Multiplies a digit string by a single digit
+INPUT: A digit string and a digit 0-9
+OUTPUT: std::string containing a * digit
+SCALE: O(n)
+LIMITATIONS: None
+DATE: 2026-10-19
+*/
+std::string multiplyDigitStringByDigit(const std::string& a, int digit);
+
+/*
+FUNCTION: Scales a digit string by a power of ten
+INPUT: A digit string and a shift (positive appends zeros, negative drops low digits)
+OUTPUT: std::string containing floor(n * 10^shift)
+SCALE: O(n + shift)
+LIMITATIONS: A negative shift of the whole length or more gives the empty string (zero)
+DATE: 2026-10-19
+*/
+std::string scaleDigitString(const std::string& n, long long shift);
+
+/*
+FUNCTION: Integer division of two digit strings
+INPUT: Dividend and non-zero divisor digit strings
+OUTPUT: std::string containing floor(dividend / divisor)
+SCALE: O(n * m) for an n-digit dividend and m-digit divisor
+LIMITATIONS: Polls CalculationContext once per quotient digit
+DATE: 2026-10-19
+*/
+std::string divideDigitStrings(const std::string& dividend, const std::string& divisor);
+
+/*
+FUNCTION: Integer square root of a digit string (Newton's method)
+INPUT: A digit string
+OUTPUT: std::string containing floor(sqrt(n))
+SCALE: O(n^2 * log n)
+LIMITATIONS: Polls CalculationContext once per Newton iteration and once per quotient digit
+DATE: 2026-10-19
+*/
+std::string sqrtDigitStrings(const std::string& n);
+
+#endif // DIGIT_STRINGS_H
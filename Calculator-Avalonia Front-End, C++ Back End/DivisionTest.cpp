@@ -0,0 +1,62 @@
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include "BigNumber.h"
+#include "DivisorContext.h"
+
+// Checks that BigNumber::operator/ and DivisorContext::divide give the same quotient, and that the
+// quotient does not depend on how the dividend is written (1e30 or 1 followed by 30 zeros).
+// Usage: division-test; exits with 1 on the first failure.
+
+static int failures = 0;
+
+static void expectEqual(const std::string& what, const std::string& actual, const std::string& expected) {
+    if (actual != expected) {
+        std::cerr << "FAIL " << what << ": got " << actual << ", expected " << expected << std::endl;
+        failures++;
+    }
+}
+
+// Divides value by divisor both ways and checks them against expected
+static void checkQuotient(const std::string& value, const std::string& divisor, const std::string& expected) {
+    BigNumber dividend(value);
+    DivisorContext context((BigNumber(divisor)));
+    std::string what = value + " / " + divisor;
+    expectEqual(what + " (operator/)", (dividend / BigNumber(divisor)).toString(), expected);
+    expectEqual(what + " (DivisorContext)", context.divide(dividend).toString(), expected);
+}
+
+// The same value in exponent form and written out in full
+static void checkNotations(const std::string& mantissa, int exponent, const std::string& divisor) {
+    std::string full = mantissa + std::string(static_cast<std::size_t>(exponent), '0');
+    std::string expected = (BigNumber(full) / BigNumber(divisor)).toString();
+    checkQuotient(mantissa + "e" + std::to_string(exponent), divisor, expected);
+    checkQuotient(full, divisor, expected);
+}
+
+int main() {
+    // Exponent-form dividends keep 20 fraction digits, like the same value written out
+    checkQuotient("1e30", "3", "333333333333333333333333333333.33333333333333333333");
+    checkQuotient("1e30", "7", "142857142857142857142857142857.14285714285714285714");
+    checkQuotient("1e-30", "3", "0.00000000000000000000000000000033333333333333333333");
+    checkQuotient("10", "4", "2.5");
+    checkQuotient("-1", "3", "-0.33333333333333333333");
+
+    // Random mantissas, exponents and divisors
+    std::mt19937_64 generator(2026);
+    for (int i = 0; i < 200; i++) {
+        std::string mantissa = std::to_string(1 + generator() % 999999999);
+        int exponent = static_cast<int>(generator() % 60);
+        std::string divisor = std::to_string(1 + generator() % 99999) + "e" +
+                              std::to_string(static_cast<int>(generator() % 21) - 10);
+        checkNotations(mantissa, exponent, divisor);
+    }
+
+    if (failures > 0) {
+        std::cerr << failures << " division checks failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All division checks passed" << std::endl;
+    return 0;
+}
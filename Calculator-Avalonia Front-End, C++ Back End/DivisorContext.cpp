@@ -0,0 +1,229 @@
+#include "DivisorContext.h"
+#include "CalculationContext.h"
+#include "DigitStrings.h"
+#include "PerformanceCounters.h"
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+// Short divisors still reduce at least this many limbs per Barrett step, so a dividend padded by the
+// usual 20 digits of precision needs a single step
+static const std::size_t MIN_CHUNK_LIMBS = 4;
+
+// ---- Limb helpers (least significant limb first, no leading zero limbs, zero is empty) ----
+
+static void trimLimbs(LimbVector& value) {
+    while (!value.empty() && value.back() == 0) {
+        value.pop_back();
+    }
+}
+
+static int compareLimbs(const LimbVector& a, const LimbVector& b) {
+    if (a.size() != b.size()) {
+        return a.size() < b.size() ? -1 : 1;
+    }
+    for (std::size_t i = a.size(); i > 0; i--) {
+        if (a[i - 1] != b[i - 1]) {
+            return a[i - 1] < b[i - 1] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+// a += b
+static void addLimbs(LimbVector& a, const LimbVector& b) {
+    if (a.size() < b.size()) {
+        a.resize(b.size(), 0u);
+    }
+    std::uint32_t carry = 0;
+    for (std::size_t i = 0; i < a.size() && (i < b.size() || carry != 0); i++) {
+        std::uint32_t sum = a[i] + (i < b.size() ? b[i] : 0u) + carry;
+        carry = sum >= LIMB_BASE ? 1u : 0u;
+        a[i] = sum - carry * LIMB_BASE;
+    }
+    if (carry != 0) {
+        a.push_back(carry);
+    }
+}
+
+// a -= b, requires a >= b
+static void subtractLimbs(LimbVector& a, const LimbVector& b) {
+    std::uint32_t borrow = 0;
+    for (std::size_t i = 0; i < a.size() && (i < b.size() || borrow != 0); i++) {
+        std::uint32_t subtrahend = (i < b.size() ? b[i] : 0u) + borrow;
+        borrow = a[i] < subtrahend ? 1u : 0u;
+        a[i] = a[i] + borrow * LIMB_BASE - subtrahend;
+    }
+    trimLimbs(a);
+}
+
+// floor(value / B^limbs)
+static LimbVector shiftDown(const LimbVector& value, std::size_t limbs) {
+    if (value.size() <= limbs) {
+        return LimbVector();
+    }
+    return LimbVector(value.begin() + limbs, value.end());
+}
+
+static LimbVector parseLimbs(const std::string& digits) {
+    LimbVector limbs = digitsToLimbs(digits);
+    trimLimbs(limbs);
+    return limbs;
+}
+
+// ---- DivisorContext ----
+
+DivisorContext::DivisorContext(const BigNumber& divisor) : divisor(divisor) {
+    if (divisor.isZero()) {
+        throw std::invalid_argument("Division by zero");
+    }
+    divisorLimbs = parseLimbs(divisor.digits);
+    std::size_t n = divisorLimbs.size();
+    chunkLimbs = std::max(n, MIN_CHUNK_LIMBS);
+    std::size_t precision = n + chunkLimbs;
+
+    // Starting guess from the top one or two limbs, kept below B^precision / D:
+    // D < (d + 1) * B^(n - j), so B^(j + 1) / (d + 1) * B^(chunkLimbs - 1) is small enough
+    std::size_t j = std::min<std::size_t>(n, 2);
+    double d = divisorLimbs[n - 1];
+    if (j == 2) {
+        d = d * LIMB_BASE + divisorLimbs[n - 2];
+    }
+    double scale = j == 2 ? 1e27 : 1e18;
+    std::uint64_t guess = static_cast<std::uint64_t>(scale / (d + 1) * (1 - 1e-12));
+    LimbVector x(chunkLimbs - 1, 0u);
+    x.push_back(static_cast<std::uint32_t>(guess % LIMB_BASE));
+    x.push_back(static_cast<std::uint32_t>(guess / LIMB_BASE));
+    trimLimbs(x);
+
+    // Newton: x += x * (B^P - D * x) / B^P. The iteration approaches B^P / D from below, so the
+    // error term stays non-negative; it stops once the correction rounds to zero.
+    LimbVector power(precision, 0u);
+    power.push_back(1u);
+    for (;;) {
+        CalculationContext::checkpoint(OP_DIVIDE, 0, 0);
+        LimbVector error = power;
+        subtractLimbs(error, multiplyLimbVectors(divisorLimbs, x));
+        LimbVector correction = shiftDown(multiplyLimbVectors(x, error), precision);
+        if (correction.empty()) {
+            break;
+        }
+        addLimbs(x, correction);
+    }
+
+    // The last correction may round down by a unit or two
+    LimbVector one(1, 1u);
+    for (;;) {
+        LimbVector next = x;
+        addLimbs(next, one);
+        if (compareLimbs(multiplyLimbVectors(divisorLimbs, next), power) > 0) {
+            break;
+        }
+        x.swap(next);
+    }
+    reciprocal.swap(x);
+}
+
+void DivisorContext::barrettStep(LimbVector& value, LimbVector& quotient) const {
+    // value < D * B^k: estimate floor(value / D) from the top of value, at most a few units low
+    std::size_t n = divisorLimbs.size();
+    quotient = shiftDown(multiplyLimbVectors(shiftDown(value, n - 1), reciprocal), chunkLimbs + 1);
+    subtractLimbs(value, multiplyLimbVectors(quotient, divisorLimbs));
+
+    LimbVector one(1, 1u);
+    while (compareLimbs(value, divisorLimbs) >= 0) {
+        subtractLimbs(value, divisorLimbs);
+        addLimbs(quotient, one);
+    }
+}
+
+void DivisorContext::divideLimbs(const LimbVector& numerator, LimbVector& quotient, LimbVector& remainder) const {
+    if (compareLimbs(numerator, divisorLimbs) < 0) {
+        quotient.clear();
+        remainder = numerator;
+        return;
+    }
+
+    // Reduce chunkLimbs limbs at a time from the top; each partial value stays below D * B^k
+    std::size_t chunks = (numerator.size() + chunkLimbs - 1) / chunkLimbs;
+    quotient.assign(chunks * chunkLimbs, 0u);
+    remainder.clear();
+    LimbVector partial;
+    LimbVector step;
+    for (std::size_t i = chunks; i > 0; i--) {
+        CalculationContext::checkpoint(OP_DIVIDE, chunks - i, chunks);
+        std::size_t low = (i - 1) * chunkLimbs;
+        std::size_t high = std::min(numerator.size(), low + chunkLimbs);
+        partial.assign(numerator.begin() + low, numerator.begin() + high);
+        if (!remainder.empty()) {
+            partial.resize(chunkLimbs, 0u);
+            partial.insert(partial.end(), remainder.begin(), remainder.end());
+        }
+        trimLimbs(partial);
+        barrettStep(partial, step);
+        std::copy(step.begin(), step.end(), quotient.begin() + low);
+        remainder.swap(partial);
+    }
+    trimLimbs(quotient);
+}
+
+BigNumber DivisorContext::divide(const BigNumber& dividend) const {
+    ScopedOperationTimer timer(OP_DIVIDE, std::max(dividend.digits.length(), divisor.digits.length()));
+    if (dividend.isZero()) {
+        return BigNumber();
+    }
+
+    // Same scaling as BigNumber::operator/: the quotient ends at the position its magnitude sets
+    long long lastPosition = BigNumber::lastKeptPosition(BigNumber::quotientLead(dividend, divisor));
+    long long shiftAmount = static_cast<long long>(dividend.exponent) - divisor.exponent - lastPosition;
+    std::string paddedDividend = scaleDigitString(dividend.digits, shiftAmount);
+    timer.addBytes(paddedDividend.length() + 2 * divisor.digits.length());
+
+    LimbVector quotient;
+    LimbVector remainder;
+    divideLimbs(parseLimbs(paddedDividend), quotient, remainder);
+
+    BigNumber result;
+    result.digits = limbsToDigits(quotient.data(), quotient.size());
+    result.exponent = static_cast<int>(lastPosition);
+    result.isNegative = dividend.isNegative != divisor.isNegative;
+    result.normalize();
+    return result;
+}
+
+BigNumber DivisorContext::modulo(const BigNumber& dividend) const {
+    ScopedOperationTimer timer(OP_DIVIDE, std::max(dividend.digits.length(), divisor.digits.length()));
+    if (dividend.isZero()) {
+        return BigNumber();
+    }
+
+    LimbVector quotient;
+    LimbVector remainder;
+    BigNumber result;
+    if (dividend.exponent >= divisor.exponent) {
+        // Both scaled to the divisor's exponent: the dividend gains trailing zeros
+        std::string scaled = dividend.digits.str();
+        scaled.append(static_cast<std::size_t>(dividend.exponent - divisor.exponent), '0');
+        divideLimbs(parseLimbs(scaled), quotient, remainder);
+        result.digits = limbsToDigits(remainder.data(), remainder.size());
+        result.exponent = divisor.exponent;
+    } else {
+        // The dividend's last s digits lie below the divisor's unit and pass through unchanged:
+        // trunc(a / d) only depends on the digits above them
+        std::size_t s = static_cast<std::size_t>(divisor.exponent - dividend.exponent);
+        const std::string& digits = dividend.digits;
+        if (digits.length() <= s) {
+            return dividend;
+        }
+        divideLimbs(parseLimbs(digits.substr(0, digits.length() - s)), quotient, remainder);
+        result.digits = limbsToDigits(remainder.data(), remainder.size()) + digits.substr(digits.length() - s);
+        result.exponent = dividend.exponent;
+    }
+    result.isNegative = dividend.isNegative;
+    result.normalize();
+    return result;
+}
+
+bool DivisorContext::isDivisible(const BigNumber& dividend) const {
+    return modulo(dividend).isZero();
+}
@@ -0,0 +1,51 @@
+#ifndef DIVISOR_CONTEXT_H
+#define DIVISOR_CONTEXT_H
+
+#include <cstddef>
+#include "BigNumber.h"
+#include "LimbArithmetic.h"
+
+/*
+CLASS: DivisorContext
+PURPOSE: Divides many numbers by the same divisor. The constructor computes a Barrett reciprocal of the
+         divisor's digits once (Newton iteration on base-10^9 limbs); each later division then costs two
+         limb multiplications plus at most a few corrective subtractions instead of a long division.
+OPERATIONS: divide (same result as BigNumber::operator/), modulo (remainder with the sign of the
+            dividend), isDivisible
+LIMITATIONS: Thread-safe: every operation is const and works on local buffers, so one context may be
+             shared read-only between threads. Dividends much longer than the divisor are reduced in
+             divisor-sized chunks. A dividend whose exponent is far above the divisor's is expanded to
+             an integer first, like the calculator's other operations.
+DATE: 2026-10-19
+*/
+class DivisorContext {
+public:
+    // Precompute the reciprocal (throws std::invalid_argument for a zero divisor)
+    explicit DivisorContext(const BigNumber& divisor);
+
+    // The divisor this context was built for
+    const BigNumber& getDivisor() const { return divisor; }
+
+    // dividend / divisor, digit for digit the same as BigNumber::operator/
+    BigNumber divide(const BigNumber& dividend) const;
+
+    // dividend - trunc(dividend / divisor) * divisor (takes the sign of the dividend)
+    BigNumber modulo(const BigNumber& dividend) const;
+
+    // Check if dividend is an integer multiple of the divisor
+    bool isDivisible(const BigNumber& dividend) const;
+
+private:
+    // Integer division of a limb number by the divisor's digits: quotient and remainder
+    void divideLimbs(const LimbVector& numerator, LimbVector& quotient, LimbVector& remainder) const;
+
+    // One Barrett step for a value below divisor * B^chunkLimbs
+    void barrettStep(LimbVector& value, LimbVector& quotient) const;
+
+    BigNumber divisor;
+    LimbVector divisorLimbs;   // |divisor digits| as an integer, no leading zero limbs
+    std::size_t chunkLimbs;    // Quotient limbs produced per Barrett step
+    LimbVector reciprocal;     // floor(B^(n + chunkLimbs) / divisorLimbs), n = divisorLimbs.size()
+};
+
+#endif // DIVISOR_CONTEXT_H
@@ -0,0 +1,160 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "BigNumber.h"
+
+// Compares BigNumber's direct double conversions with the string round trips they replace, and checks
+// that both give the same results. Usage: double-benchmark [values per set]
+
+// Each timing sample runs the operation for at least this long
+static const std::chrono::milliseconds SAMPLE_TIME(200);
+
+// The best of this many samples is kept
+static const int SAMPLES = 3;
+
+static std::mt19937_64 generator(12345);
+
+// Seconds per pass over a value set: best of SAMPLES samples, each repeated for at least SAMPLE_TIME
+template <typename Operation>
+static double timeOperation(Operation operation) {
+    typedef std::chrono::steady_clock Clock;
+    double best = 0;
+    for (int sample = 0; sample < SAMPLES; sample++) {
+        Clock::time_point start = Clock::now();
+        Clock::duration elapsed(0);
+        long calls = 0;
+        do {
+            operation();
+            calls++;
+            elapsed = Clock::now() - start;
+        } while (elapsed < SAMPLE_TIME);
+        double perCall = std::chrono::duration<double>(elapsed).count() / calls;
+        if (sample == 0 || perCall < best) {
+            best = perCall;
+        }
+    }
+    return best;
+}
+
+// Finite doubles with uniformly random bit patterns (every magnitude equally likely)
+static std::vector<double> randomBitPatterns(std::size_t count) {
+    std::vector<double> values;
+    while (values.size() < count) {
+        std::uint64_t bits = generator();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (std::isfinite(value)) {
+            values.push_back(value);
+        }
+    }
+    return values;
+}
+
+// Amounts with two decimals, the usual front-end input
+static std::vector<double> randomAmounts(std::size_t count) {
+    std::vector<double> values;
+    for (std::size_t i = 0; i < count; i++) {
+        values.push_back(static_cast<double>(generator() % 100000000) / 100);
+    }
+    return values;
+}
+
+// The string path for shortest output: the fewest %.*g digits that read back as the same double
+static std::string shortestByPrinting(double value) {
+    char buffer[32];
+    for (int precision = 1; precision <= 17; precision++) {
+        std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+        if (std::strtod(buffer, nullptr) == value) {
+            break;
+        }
+    }
+    return buffer;
+}
+
+static void report(const char* name, std::size_t count, double stringPath, double direct) {
+    std::cout << "  " << name << ": " << stringPath / count * 1e9 << " ns via strings, " << direct / count * 1e9
+              << " ns direct (" << stringPath / direct << "x)" << std::endl;
+}
+
+static void benchmarkSet(const char* name, const std::vector<double>& values) {
+    std::cout << name << " (" << values.size() << " values)" << std::endl;
+    std::vector<BigNumber> numbers;
+    for (double value : values) {
+        numbers.push_back(BigNumber::fromDoubleShortest(value));
+    }
+
+    // Both paths must agree before their timings mean anything
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < values.size(); i++) {
+        double parsed = std::strtod(numbers[i].toString().c_str(), nullptr);
+        if (numbers[i].toDouble() != values[i] || parsed != values[i] ||
+            BigNumber::fromDouble(values[i]).toDouble() != values[i]) {
+            mismatches++;
+        }
+    }
+    std::cout << "  mismatches: " << mismatches << std::endl;
+
+    std::size_t sink = 0;
+    double stringPath = timeOperation([&]() {
+        for (double value : values) {
+            sink += BigNumber(shortestByPrinting(value)).isNeg();
+        }
+    });
+    double direct = timeOperation([&]() {
+        for (double value : values) {
+            sink += BigNumber::fromDoubleShortest(value).isNeg();
+        }
+    });
+    report("shortest double -> BigNumber", values.size(), stringPath, direct);
+
+    stringPath = timeOperation([&]() {
+        char buffer[32];
+        for (double value : values) {
+            std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+            sink += BigNumber(buffer).isNeg();
+        }
+    });
+    direct = timeOperation([&]() {
+        for (double value : values) {
+            sink += BigNumber::fromDouble(value).isNeg();
+        }
+    });
+    report("%.17g vs exact double -> BigNumber", values.size(), stringPath, direct);
+
+    double total = 0;
+    stringPath = timeOperation([&]() {
+        for (const BigNumber& number : numbers) {
+            total += std::strtod(number.toString().c_str(), nullptr);
+        }
+    });
+    direct = timeOperation([&]() {
+        for (const BigNumber& number : numbers) {
+            total += number.toDouble();
+        }
+    });
+    report("BigNumber -> double", values.size(), stringPath, direct);
+
+    // Keep the results observable so the loops are not optimized away
+    if (sink == static_cast<std::size_t>(-1) || total == 1.5) {
+        std::cout << "  (" << sink << ", " << total << ")" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 10000;
+    if (count == 0) {
+        std::cerr << "Usage: double-benchmark [values per set]" << std::endl;
+        return 1;
+    }
+
+    benchmarkSet("Random bit patterns", randomBitPatterns(count));
+    benchmarkSet("Two-decimal amounts", randomAmounts(count));
+    return 0;
+}
@@ -0,0 +1,457 @@
+#include "DoubleConversion.h"
+#include "LimbArithmetic.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+static const int DOUBLE_MANTISSA_BITS = 52;
+static const int DOUBLE_BIAS = 1023;
+static const std::uint64_t DOUBLE_INFINITY_BITS = 0x7FFull << DOUBLE_MANTISSA_BITS;
+
+// Ryu keeps 125 significant bits of 5^i and of its reciprocal
+static const int RYU_POW5_BITS = 125;
+static const int RYU_POW5_TABLE_SIZE = 326;
+static const int RYU_INVERSE_TABLE_SIZE = 342;
+
+// Eisel-Lemire covers w * 10^q for q in [-342, 308]; outside it every w gives zero or infinity
+static const int LEMIRE_MIN_POWER = -342;
+static const int LEMIRE_MAX_POWER = 308;
+
+// floor(2^RECIPROCAL_BITS / 5^n) keeps every bit the reciprocal tables need (at most 2 * 795 + 128)
+static const int RECIPROCAL_BITS = 1792;
+
+// ---- 128-bit helpers ----
+
+struct UInt128 {
+    std::uint64_t high;
+    std::uint64_t low;
+};
+
+static UInt128 multiply64(std::uint64_t a, std::uint64_t b) {
+    UInt128 result;
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    result.high = static_cast<std::uint64_t>(product >> 64);
+    result.low = static_cast<std::uint64_t>(product);
+#else
+    std::uint64_t aLow = a & 0xFFFFFFFFu;
+    std::uint64_t aHigh = a >> 32;
+    std::uint64_t bLow = b & 0xFFFFFFFFu;
+    std::uint64_t bHigh = b >> 32;
+    std::uint64_t lowLow = aLow * bLow;
+    std::uint64_t lowHigh = aLow * bHigh;
+    std::uint64_t highLow = aHigh * bLow;
+    std::uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFFu) + (highLow & 0xFFFFFFFFu);
+    result.low = (middle << 32) | (lowLow & 0xFFFFFFFFu);
+    result.high = aHigh * bHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#endif
+    return result;
+}
+
+// Low 64 bits of value >> shift
+static std::uint64_t shiftRight128(const UInt128& value, int shift) {
+    if (shift == 0) {
+        return value.low;
+    }
+    if (shift >= 64) {
+        return value.high >> (shift - 64);
+    }
+    return (value.high << (64 - shift)) | (value.low >> shift);
+}
+
+static int leadingZeros64(std::uint64_t value) {
+    int count = 0;
+    for (std::uint64_t bit = 1ull << 63; bit != 0 && (value & bit) == 0; bit >>= 1) {
+        count++;
+    }
+    return count;
+}
+
+// ---- Exact binary integers for building the tables (least significant word first) ----
+
+typedef std::vector<std::uint32_t> BinaryInteger;
+
+static void trimBinary(BinaryInteger& x) {
+    while (!x.empty() && x.back() == 0) {
+        x.pop_back();
+    }
+}
+
+static int bitLength(const BinaryInteger& x) {
+    if (x.empty()) {
+        return 0;
+    }
+    int length = static_cast<int>(x.size() - 1) * 32;
+    for (std::uint32_t top = x.back(); top != 0; top >>= 1) {
+        length++;
+    }
+    return length;
+}
+
+static bool bitAt(const BinaryInteger& x, int position) {
+    if (position < 0 || position >= static_cast<int>(x.size()) * 32) {
+        return false;
+    }
+    return ((x[position / 32] >> (position % 32)) & 1u) != 0;
+}
+
+static void multiplySmall(BinaryInteger& x, std::uint32_t factor) {
+    std::uint64_t carry = 0;
+    for (std::uint32_t& word : x) {
+        std::uint64_t current = static_cast<std::uint64_t>(word) * factor + carry;
+        word = static_cast<std::uint32_t>(current);
+        carry = current >> 32;
+    }
+    if (carry != 0) {
+        x.push_back(static_cast<std::uint32_t>(carry));
+    }
+}
+
+// x = floor(x / divisor)
+static void divideSmall(BinaryInteger& x, std::uint32_t divisor) {
+    std::uint64_t remainder = 0;
+    for (std::size_t i = x.size(); i-- > 0;) {
+        std::uint64_t current = (remainder << 32) | x[i];
+        x[i] = static_cast<std::uint32_t>(current / divisor);
+        remainder = current % divisor;
+    }
+    trimBinary(x);
+}
+
+// floor(x / 2^bits) + 1
+static BinaryInteger shiftRightPlusOne(const BinaryInteger& x, int bits) {
+    BinaryInteger result((x.size() * 32 - std::min<std::size_t>(bits, x.size() * 32)) / 32 + 1, 0u);
+    for (int i = 0; i < static_cast<int>(result.size()) * 32; i++) {
+        if (bitAt(x, i + bits)) {
+            result[i / 32] |= 1u << (i % 32);
+        }
+    }
+    for (std::uint32_t& word : result) {
+        if (++word != 0) {
+            break;
+        }
+    }
+    trimBinary(result);
+    return result;
+}
+
+// Bits [start, start + 128) of x; a negative start shifts x left
+static UInt128 bitsFrom(const BinaryInteger& x, int start) {
+    UInt128 result = {0, 0};
+    for (int i = 0; i < 64; i++) {
+        result.low |= static_cast<std::uint64_t>(bitAt(x, start + i)) << i;
+        result.high |= static_cast<std::uint64_t>(bitAt(x, start + 64 + i)) << i;
+    }
+    return result;
+}
+
+/*
+STRUCT: PowerTables
+PURPOSE: Truncated and reciprocal powers of five shared by the Ryu and Eisel-Lemire kernels
+DATE: 2026-10-19
+*/
+struct PowerTables {
+    UInt128 pow5[RYU_POW5_TABLE_SIZE];        // 5^i cut to its top 125 bits
+    UInt128 inversePow5[RYU_INVERSE_TABLE_SIZE];  // floor(2^(bitLength(5^i) - 1 + 125) / 5^i) + 1
+    UInt128 lemire[LEMIRE_MAX_POWER - LEMIRE_MIN_POWER + 1];  // 5^q scaled to 128 bits, q >= -342
+};
+
+// 5^n and floor(2^RECIPROCAL_BITS / 5^n) are carried from n to n + 1 exactly; floor(floor(a / b) / c)
+// equals floor(a / (b * c)), so every reciprocal entry is an exact floor of a power of two over 5^n
+static PowerTables buildPowerTables() {
+    PowerTables tables;
+    BinaryInteger power(1, 1u);
+    BinaryInteger reciprocal(RECIPROCAL_BITS / 32 + 1, 0u);
+    reciprocal.back() = 1u << (RECIPROCAL_BITS % 32);
+
+    for (int n = 0; n <= -LEMIRE_MIN_POWER; n++) {
+        if (n > 0) {
+            multiplySmall(power, 5);
+            divideSmall(reciprocal, 5);
+        }
+        int length = bitLength(power);
+        if (n < RYU_POW5_TABLE_SIZE) {
+            tables.pow5[n] = bitsFrom(power, length - RYU_POW5_BITS);
+        }
+        if (n < RYU_INVERSE_TABLE_SIZE) {
+            tables.inversePow5[n] = bitsFrom(shiftRightPlusOne(reciprocal, RECIPROCAL_BITS - (length - 1 + RYU_POW5_BITS)), 0);
+        }
+        if (n <= LEMIRE_MAX_POWER) {
+            tables.lemire[n - LEMIRE_MIN_POWER] = bitsFrom(power, length - 128);
+        }
+        if (n > 0) {
+            // Small reciprocals are taken to exactly 128 bits; larger ones with extra bits, then truncated
+            int bits = n <= 27 ? length + 127 : 2 * length + 128;
+            BinaryInteger inverse = shiftRightPlusOne(reciprocal, RECIPROCAL_BITS - bits);
+            tables.lemire[-n - LEMIRE_MIN_POWER] = bitsFrom(inverse, std::max(0, bitLength(inverse) - 128));
+        }
+    }
+    return tables;
+}
+
+static const PowerTables& powerTables() {
+    static const PowerTables tables = buildPowerTables();
+    return tables;
+}
+
+// ---- Ryu ----
+
+// ceil(log2(5^e)) for e > 0, 1 for e == 0
+static int pow5Bits(int e) {
+    return static_cast<int>((static_cast<std::uint32_t>(e) * 1217359u) >> 19) + 1;
+}
+
+// floor(log10(2^e)) and floor(log10(5^e))
+static int log10Pow2(int e) {
+    return static_cast<int>((static_cast<std::uint32_t>(e) * 78913u) >> 18);
+}
+
+static int log10Pow5(int e) {
+    return static_cast<int>((static_cast<std::uint32_t>(e) * 732923u) >> 20);
+}
+
+static bool multipleOfPowerOf5(std::uint64_t value, int p) {
+    int count = 0;
+    while (value != 0 && value % 5 == 0) {
+        value /= 5;
+        count++;
+    }
+    return count >= p;
+}
+
+static bool multipleOfPowerOf2(std::uint64_t value, int p) {
+    return (value & ((1ull << p) - 1)) == 0;
+}
+
+// (m * multiplier) >> shift for a 125-bit multiplier
+static std::uint64_t multiplyShift(std::uint64_t m, const UInt128& multiplier, int shift) {
+    UInt128 low = multiply64(m, multiplier.low);
+    UInt128 high = multiply64(m, multiplier.high);
+    UInt128 sum;
+    sum.low = high.low + low.high;
+    sum.high = high.high + (sum.low < high.low ? 1 : 0);
+    return shiftRight128(sum, shift - 64);
+}
+
+void shortestDecimal(double value, std::uint64_t& digits, int& exponent) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    std::uint64_t ieeeMantissa = bits & ((1ull << DOUBLE_MANTISSA_BITS) - 1);
+    int ieeeExponent = static_cast<int>((bits >> DOUBLE_MANTISSA_BITS) & 0x7FF);
+    const PowerTables& tables = powerTables();
+
+    // value = m2 * 2^e2, with two extra bits so the interval bounds are integers
+    int e2;
+    std::uint64_t m2;
+    if (ieeeExponent == 0) {
+        e2 = 1 - DOUBLE_BIAS - DOUBLE_MANTISSA_BITS - 2;
+        m2 = ieeeMantissa;
+    } else {
+        e2 = ieeeExponent - DOUBLE_BIAS - DOUBLE_MANTISSA_BITS - 2;
+        m2 = (1ull << DOUBLE_MANTISSA_BITS) | ieeeMantissa;
+    }
+    bool acceptBounds = (m2 & 1) == 0;
+
+    // Every decimal in [mm, mp] * 2^e2 (bounds included when m2 is even) rounds to value; the lower
+    // gap is half as wide at the bottom of a binade
+    std::uint64_t mv = 4 * m2;
+    std::uint64_t mmShift = (ieeeMantissa != 0 || ieeeExponent <= 1) ? 1 : 0;
+
+    // Scale the interval to decimal: vr, vp, vm = floor(mv, mp, mm * 2^e2 / 10^e10)
+    std::uint64_t vr, vp, vm;
+    int e10;
+    bool vmIsTrailingZeros = false;
+    bool vrIsTrailingZeros = false;
+    if (e2 >= 0) {
+        int q = log10Pow2(e2) - (e2 > 3 ? 1 : 0);
+        e10 = q;
+        int k = RYU_POW5_BITS + pow5Bits(q) - 1;
+        int i = -e2 + q + k;
+        vr = multiplyShift(4 * m2, tables.inversePow5[q], i);
+        vp = multiplyShift(4 * m2 + 2, tables.inversePow5[q], i);
+        vm = multiplyShift(4 * m2 - 1 - mmShift, tables.inversePow5[q], i);
+        if (q <= 21) {
+            // At most one of mv, mp and mm is a multiple of 5
+            if (mv % 5 == 0) {
+                vrIsTrailingZeros = multipleOfPowerOf5(mv, q);
+            } else if (acceptBounds) {
+                vmIsTrailingZeros = multipleOfPowerOf5(mv - 1 - mmShift, q);
+            } else {
+                vp -= multipleOfPowerOf5(mv + 2, q) ? 1 : 0;
+            }
+        }
+    } else {
+        int q = log10Pow5(-e2) - (-e2 > 1 ? 1 : 0);
+        e10 = q + e2;
+        int i = -e2 - q;
+        int k = pow5Bits(i) - RYU_POW5_BITS;
+        int j = q - k;
+        vr = multiplyShift(4 * m2, tables.pow5[i], j);
+        vp = multiplyShift(4 * m2 + 2, tables.pow5[i], j);
+        vm = multiplyShift(4 * m2 - 1 - mmShift, tables.pow5[i], j);
+        if (q <= 1) {
+            // mv has at least q trailing zero bits; mp or mm may share them
+            vrIsTrailingZeros = true;
+            if (acceptBounds) {
+                vmIsTrailingZeros = mmShift == 1;
+            } else {
+                vp--;
+            }
+        } else if (q < 63) {
+            vrIsTrailingZeros = multipleOfPowerOf2(mv, q);
+        }
+    }
+
+    // Drop digits while the interval still holds a shorter number
+    int removed = 0;
+    std::uint64_t lastRemovedDigit = 0;
+    std::uint64_t output;
+    if (vmIsTrailingZeros || vrIsTrailingZeros) {
+        // Exact bounds or an exact tie are possible: track the removed digits
+        while (vp / 10 > vm / 10) {
+            vmIsTrailingZeros = vmIsTrailingZeros && vm % 10 == 0;
+            vrIsTrailingZeros = vrIsTrailingZeros && lastRemovedDigit == 0;
+            lastRemovedDigit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vmIsTrailingZeros) {
+            while (vm % 10 == 0) {
+                vrIsTrailingZeros = vrIsTrailingZeros && lastRemovedDigit == 0;
+                lastRemovedDigit = vr % 10;
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) {
+            // The exact value ends in 50...0: round to even
+            lastRemovedDigit = 4;
+        }
+        output = vr + (((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5) ? 1 : 0);
+    } else {
+        // Common case: no exact ties, so only the last removed digit decides the rounding
+        bool roundUp = false;
+        if (vp / 100 > vm / 100) {
+            roundUp = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10) {
+            roundUp = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + ((vr == vm || roundUp) ? 1 : 0);
+    }
+
+    digits = output;
+    exponent = e10 + removed;
+}
+
+// ---- Eisel-Lemire ----
+
+std::uint64_t decimalToDoubleBits(std::uint64_t w, long long q) {
+    if (w == 0 || q < LEMIRE_MIN_POWER) {
+        return 0;
+    }
+    if (q > LEMIRE_MAX_POWER) {
+        return DOUBLE_INFINITY_BITS;
+    }
+    const UInt128& power = powerTables().lemire[q - LEMIRE_MIN_POWER];
+
+    // w * 5^q to 128 bits; the low word of 5^q only matters when the top 55 bits are not yet settled
+    int leadingZeros = leadingZeros64(w);
+    w <<= leadingZeros;
+    UInt128 product = multiply64(w, power.high);
+    const std::uint64_t precisionMask = 0xFFFFFFFFFFFFFFFFull >> (DOUBLE_MANTISSA_BITS + 3);
+    if ((product.high & precisionMask) == precisionMask) {
+        UInt128 second = multiply64(w, power.low);
+        product.low += second.high;
+        if (second.high > product.low) {
+            product.high++;
+        }
+    }
+
+    // Keep 54 bits (one past the mantissa for rounding) and work out the binary exponent:
+    // floor(log2(10^q)) + 63 = ((217706 * q) >> 16) + 63
+    int upperBit = static_cast<int>(product.high >> 63);
+    int shift = upperBit + 64 - DOUBLE_MANTISSA_BITS - 3;
+    std::uint64_t mantissa = product.high >> shift;
+    int power2 = static_cast<int>(((217706 * q) >> 16) + 63) + upperBit - leadingZeros + DOUBLE_BIAS;
+
+    if (power2 <= 0) {
+        // Subnormal: shift down to the fixed exponent, then round half up (an exact tie cannot occur)
+        if (-power2 + 1 >= 64) {
+            return 0;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        // Rounding may carry into the smallest normal exponent; the carried bit sets it
+        return mantissa;
+    }
+
+    // An exact tie (only possible for small q) rounds to even instead of up
+    if (product.low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == product.high) {
+        mantissa &= ~1ull;
+    }
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (2ull << DOUBLE_MANTISSA_BITS)) {
+        mantissa = 1ull << DOUBLE_MANTISSA_BITS;
+        power2++;
+    }
+    mantissa &= ~(1ull << DOUBLE_MANTISSA_BITS);
+    if (power2 >= 0x7FF) {
+        return DOUBLE_INFINITY_BITS;
+    }
+    return mantissa | (static_cast<std::uint64_t>(power2) << DOUBLE_MANTISSA_BITS);
+}
+
+// ---- Exact binary to decimal ----
+
+// limbs *= factor, for factor below 2^31
+static void multiplyLimbsSmall(LimbVector& limbs, std::uint32_t factor) {
+    std::uint64_t carry = 0;
+    for (std::uint32_t& limb : limbs) {
+        std::uint64_t current = static_cast<std::uint64_t>(limb) * factor + carry;
+        limb = static_cast<std::uint32_t>(current % LIMB_BASE);
+        carry = current / LIMB_BASE;
+    }
+    while (carry != 0) {
+        limbs.push_back(static_cast<std::uint32_t>(carry % LIMB_BASE));
+        carry /= LIMB_BASE;
+    }
+}
+
+// m * 2^e is m * 2^e for e >= 0 and m * 5^-e * 10^e otherwise
+std::string binaryToDecimalDigits(std::uint64_t mantissa, int binaryExponent, int& decimalExponent) {
+    LimbVector limbs;
+    while (mantissa != 0) {
+        limbs.push_back(static_cast<std::uint32_t>(mantissa % LIMB_BASE));
+        mantissa /= LIMB_BASE;
+    }
+
+    if (binaryExponent >= 0) {
+        decimalExponent = 0;
+        for (int remaining = binaryExponent; remaining > 0; remaining -= 29) {
+            multiplyLimbsSmall(limbs, 1u << std::min(remaining, 29));
+        }
+    } else {
+        decimalExponent = binaryExponent;
+        static const std::uint32_t POWERS_OF_FIVE[] = {1u, 5u, 25u, 125u, 625u, 3125u, 15625u, 78125u, 390625u,
+                                                       1953125u, 9765625u, 48828125u, 244140625u, 1220703125u};
+        for (int remaining = -binaryExponent; remaining > 0; remaining -= 13) {
+            multiplyLimbsSmall(limbs, POWERS_OF_FIVE[std::min(remaining, 13)]);
+        }
+    }
+    return limbsToDigits(limbs.data(), limbs.size());
+}
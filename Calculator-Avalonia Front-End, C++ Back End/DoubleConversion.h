@@ -0,0 +1,45 @@
+#ifndef DOUBLE_CONVERSION_H
+#define DOUBLE_CONVERSION_H
+
+#include <cstdint>
+#include <string>
+
+/*
+Kernels for converting between IEEE-754 doubles and decimal digits without going through text, used
+by BigNumber::fromDouble, fromDoubleShortest and toDouble. Both directions multiply by 128-bit
+approximations of powers of five, built once on first use from exact binary integers.
+*/
+
+/*
+FUNCTION: Finds the shortest decimal that rounds back to a double (Ryu)
+INPUT: A finite, non-zero, positive double; references for the result
+OUTPUT: void (value is the double nearest to digits * 10^exponent, digits has as few decimal digits as
+        possible, and among those it is the one closest to value)
+SCALE: O(1): three 64x128-bit products and at most 17 divisions by ten
+LIMITATIONS: Negative values, zero, infinities and NaN are handled by the caller
+DATE: 2026-10-19
+*/
+void shortestDecimal(double value, std::uint64_t& digits, int& exponent);
+
+/*
+FUNCTION: Rounds w * 10^q to the nearest double (Eisel-Lemire)
+INPUT: A non-zero decimal significand w and a power of ten q
+OUTPUT: std::uint64_t, the bit pattern of the nearest positive double (ties to even); values past the
+        largest double give infinity and values below half the smallest subnormal give zero
+SCALE: O(1): one or two 64x64-bit products
+LIMITATIONS: None for any w and q; significands longer than 19 digits are truncated by the caller
+DATE: 2026-10-19
+*/
+std::uint64_t decimalToDoubleBits(std::uint64_t w, long long q);
+
+/*
+FUNCTION: Writes the exact decimal value of mantissa * 2^binaryExponent
+INPUT: Binary mantissa and exponent; reference for the decimal exponent
+OUTPUT: std::string of decimal digits; the value is digits * 10^decimalExponent
+SCALE: O(d^2 / 9) for d output digits (at most about 770 for a double)
+LIMITATIONS: None
+DATE: 2026-10-19
+*/
+std::string binaryToDecimalDigits(std::uint64_t mantissa, int binaryExponent, int& decimalExponent);
+
+#endif // DOUBLE_CONVERSION_H
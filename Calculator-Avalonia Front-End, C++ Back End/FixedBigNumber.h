@@ -0,0 +1,289 @@
+#ifndef FIXED_BIG_NUMBER_H
+#define FIXED_BIG_NUMBER_H
+
+#include "BigNumber.h"
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+// Ask the compiler to fully unroll fixed-trip-count limb loops
+#if defined(__clang__)
+#define FIXED_BIG_NUMBER_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && __GNUC__ >= 8
+#define FIXED_BIG_NUMBER_UNROLL _Pragma("GCC unroll 128")
+#else
+#define FIXED_BIG_NUMBER_UNROLL
+#endif
+
+/*
+CLASS: FixedBigNumber<Bits>
+PURPOSE: Signed integer with compile-time fixed capacity (every value below 2^Bits in magnitude fits)
+         for bounded-size workloads. Storage is an inline array of base-10^9 limbs, so there is no heap
+         allocation and conversion to and from BigNumber's decimal digits is a single linear pass.
+OPERATIONS: constexpr addition, subtraction, multiplication, negation and comparison;
+            conversion to and from BigNumber and strings
+LIMITATIONS: Integers only; converting a BigNumber with a fractional part throws std::invalid_argument.
+             Results that do not fit LIMBS limbs throw std::overflow_error (a compile error in constant
+             expressions). Requires C++14.
+DATE: 2026-10-19
+*/
+template <std::size_t Bits>
+class FixedBigNumber {
+public:
+    static constexpr std::size_t LIMB_DIGITS = 9;
+    static constexpr std::uint32_t LIMB_BASE = 1000000000u;
+    // Decimal digits of 2^Bits, rounded up to whole limbs
+    static constexpr std::size_t DIGITS = Bits * 30103 / 100000 + 1;
+    static constexpr std::size_t LIMBS = (DIGITS + LIMB_DIGITS - 1) / LIMB_DIGITS;
+
+    // Default constructor - creates zero
+    constexpr FixedBigNumber() : limbs{}, negative(false) {}
+
+    // Constructor from a built-in integer
+    constexpr FixedBigNumber(long long value) : limbs{}, negative(value < 0) {
+        // Negate in unsigned arithmetic so LLONG_MIN is handled
+        unsigned long long magnitude = negative ? 0ULL - static_cast<unsigned long long>(value)
+                                                : static_cast<unsigned long long>(value);
+        for (std::size_t i = 0; magnitude != 0; i++) {
+            if (i >= LIMBS) {
+                throw std::overflow_error("FixedBigNumber overflow");
+            }
+            limbs[i] = static_cast<std::uint32_t>(magnitude % LIMB_BASE);
+            magnitude /= LIMB_BASE;
+        }
+    }
+
+    // Constructor from a BigNumber (must be an integer that fits)
+    explicit FixedBigNumber(const BigNumber& value) : limbs{}, negative(false) {
+        if (value.isZero()) {
+            return;
+        }
+        if (value.exponent < 0) {
+            throw std::invalid_argument("FixedBigNumber holds integers only");
+        }
+
+        static const std::uint32_t powers[LIMB_DIGITS] = {
+            1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u
+        };
+
+        // Walk digits from least significant; digit k has weight 10^(exponent + k)
+        const std::string& digits = value.digits;
+        std::size_t position = static_cast<std::size_t>(value.exponent);
+        for (std::size_t k = digits.length(); k-- > 0; position++) {
+            std::uint32_t digit = static_cast<std::uint32_t>(digits[k] - '0');
+            if (digit == 0) {
+                continue;
+            }
+            if (position >= LIMBS * LIMB_DIGITS) {
+                throw std::overflow_error("FixedBigNumber overflow");
+            }
+            limbs[position / LIMB_DIGITS] += digit * powers[position % LIMB_DIGITS];
+        }
+        negative = value.isNegative;
+    }
+
+    // Constructor from a numeric string (parsed by BigNumber)
+    explicit FixedBigNumber(const std::string& numStr) : FixedBigNumber(BigNumber(numStr)) {}
+
+    // Convert to a BigNumber
+    BigNumber toBigNumber() const {
+        BigNumber result;
+        if (isZero()) {
+            return result;
+        }
+
+        std::size_t top = LIMBS - 1;
+        while (limbs[top] == 0) {
+            top--;
+        }
+
+        // Most significant limb unpadded, every lower limb padded to 9 digits
+        std::string digits = std::to_string(limbs[top]);
+        digits.reserve(digits.length() + top * LIMB_DIGITS);
+        char buffer[LIMB_DIGITS];
+        for (std::size_t i = top; i-- > 0;) {
+            std::uint32_t limb = limbs[i];
+            for (std::size_t d = LIMB_DIGITS; d-- > 0;) {
+                buffer[d] = static_cast<char>('0' + limb % 10);
+                limb /= 10;
+            }
+            digits.append(buffer, LIMB_DIGITS);
+        }
+
+        result.digits = digits;
+        result.exponent = 0;
+        result.isNegative = negative;
+        return result;
+    }
+
+    // Convert to string for output
+    std::string toString() const {
+        return toBigNumber().toString();
+    }
+
+    // Read one base-10^9 limb (index 0 is least significant)
+    constexpr std::uint32_t limb(std::size_t index) const {
+        return limbs[index];
+    }
+
+    // Check if the number is zero
+    constexpr bool isZero() const {
+        FIXED_BIG_NUMBER_UNROLL
+        for (std::size_t i = 0; i < LIMBS; i++) {
+            if (limbs[i] != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Check if the number is negative
+    constexpr bool isNeg() const {
+        return negative;
+    }
+
+    // Get the sign of the number (-1, 0, 1)
+    constexpr int sign() const {
+        return isZero() ? 0 : (negative ? -1 : 1);
+    }
+
+    // Compare absolute values of two FixedBigNumbers
+    static constexpr int compareAbsoluteValue(const FixedBigNumber& a, const FixedBigNumber& b) {
+        FIXED_BIG_NUMBER_UNROLL
+        for (std::size_t k = 0; k < LIMBS; k++) {
+            std::size_t i = LIMBS - 1 - k;
+            if (a.limbs[i] != b.limbs[i]) {
+                return a.limbs[i] > b.limbs[i] ? 1 : -1;
+            }
+        }
+        return 0;
+    }
+
+    // Returns absolute value of this number
+    constexpr FixedBigNumber abs() const {
+        FixedBigNumber result = *this;
+        result.negative = false;
+        return result;
+    }
+
+    // Negation operator
+    constexpr FixedBigNumber operator-() const {
+        FixedBigNumber result = *this;
+        result.negative = !negative && !isZero();
+        return result;
+    }
+
+    // Addition operator
+    constexpr FixedBigNumber operator+(const FixedBigNumber& other) const {
+        FixedBigNumber result;
+        if (negative == other.negative) {
+            addMagnitudes(result.limbs, limbs, other.limbs);
+            result.negative = negative;
+        } else if (compareAbsoluteValue(*this, other) >= 0) {
+            subtractMagnitudes(result.limbs, limbs, other.limbs);
+            result.negative = negative;
+        } else {
+            subtractMagnitudes(result.limbs, other.limbs, limbs);
+            result.negative = other.negative;
+        }
+        if (result.isZero()) {
+            result.negative = false;
+        }
+        return result;
+    }
+
+    // Subtraction operator
+    constexpr FixedBigNumber operator-(const FixedBigNumber& other) const {
+        return *this + (-other);
+    }
+
+    // Multiplication operator (schoolbook over LIMBS x LIMBS limbs)
+    constexpr FixedBigNumber operator*(const FixedBigNumber& other) const {
+        FixedBigNumber result;
+        std::uint64_t product[LIMBS] = {};
+
+        FIXED_BIG_NUMBER_UNROLL
+        for (std::size_t i = 0; i < LIMBS; i++) {
+            if (limbs[i] == 0) {
+                continue;
+            }
+            std::uint64_t carry = 0;
+            FIXED_BIG_NUMBER_UNROLL
+            for (std::size_t j = 0; j < LIMBS; j++) {
+                std::uint64_t term = static_cast<std::uint64_t>(limbs[i]) * other.limbs[j];
+                if (i + j >= LIMBS) {
+                    if (term != 0 || carry != 0) {
+                        throw std::overflow_error("FixedBigNumber overflow");
+                    }
+                    continue;
+                }
+                // term < 10^18, so term + limb + carry stays far below 2^64
+                std::uint64_t current = product[i + j] + term + carry;
+                product[i + j] = current % LIMB_BASE;
+                carry = current / LIMB_BASE;
+            }
+            if (carry != 0) {
+                throw std::overflow_error("FixedBigNumber overflow");
+            }
+        }
+
+        FIXED_BIG_NUMBER_UNROLL
+        for (std::size_t i = 0; i < LIMBS; i++) {
+            result.limbs[i] = static_cast<std::uint32_t>(product[i]);
+        }
+        result.negative = (negative != other.negative) && !result.isZero();
+        return result;
+    }
+
+    constexpr FixedBigNumber& operator+=(const FixedBigNumber& other) { return *this = *this + other; }
+    constexpr FixedBigNumber& operator-=(const FixedBigNumber& other) { return *this = *this - other; }
+    constexpr FixedBigNumber& operator*=(const FixedBigNumber& other) { return *this = *this * other; }
+
+    // Comparison operators
+    constexpr bool operator==(const FixedBigNumber& other) const {
+        return negative == other.negative && compareAbsoluteValue(*this, other) == 0;
+    }
+    constexpr bool operator!=(const FixedBigNumber& other) const { return !(*this == other); }
+    constexpr bool operator<(const FixedBigNumber& other) const {
+        if (negative != other.negative) {
+            return negative;
+        }
+        int cmp = compareAbsoluteValue(*this, other);
+        return negative ? cmp > 0 : cmp < 0;
+    }
+    constexpr bool operator>(const FixedBigNumber& other) const { return other < *this; }
+    constexpr bool operator<=(const FixedBigNumber& other) const { return !(other < *this); }
+    constexpr bool operator>=(const FixedBigNumber& other) const { return !(*this < other); }
+
+private:
+    std::uint32_t limbs[LIMBS];  // Base-10^9 limbs, least significant first
+    bool negative;               // Sign of the number (never set for zero)
+
+    // out = a + b on magnitudes
+    static constexpr void addMagnitudes(std::uint32_t* out, const std::uint32_t* a, const std::uint32_t* b) {
+        std::uint32_t carry = 0;
+        FIXED_BIG_NUMBER_UNROLL
+        for (std::size_t i = 0; i < LIMBS; i++) {
+            std::uint32_t sum = a[i] + b[i] + carry;  // < 2 * 10^9 + 1, fits in 32 bits
+            carry = sum >= LIMB_BASE ? 1u : 0u;
+            out[i] = sum - carry * LIMB_BASE;
+        }
+        if (carry != 0) {
+            throw std::overflow_error("FixedBigNumber overflow");
+        }
+    }
+
+    // out = a - b on magnitudes (requires |a| >= |b|)
+    static constexpr void subtractMagnitudes(std::uint32_t* out, const std::uint32_t* a, const std::uint32_t* b) {
+        std::uint32_t borrow = 0;
+        FIXED_BIG_NUMBER_UNROLL
+        for (std::size_t i = 0; i < LIMBS; i++) {
+            std::uint32_t subtrahend = b[i] + borrow;
+            borrow = a[i] < subtrahend ? 1u : 0u;
+            out[i] = a[i] + borrow * LIMB_BASE - subtrahend;
+        }
+    }
+};
+
+#endif // FIXED_BIG_NUMBER_H
@@ -0,0 +1,243 @@
+#include "LimbArithmetic.h"
+#include "CalculationContext.h"
+#include "TuningConfig.h"
+#include <algorithm>
+#include <future>
+#include <thread>
+
+std::size_t getKaratsubaThreshold() {
+    return TuningConfig::karatsubaLimbs();
+}
+
+void setKaratsubaThreshold(std::size_t limbs) {
+    TuningParameters parameters = TuningConfig::get();
+    parameters.karatsubaLimbs = limbs;
+    TuningConfig::set(parameters);
+}
+
+LimbVector digitsToLimbs(const std::string& digits) {
+    LimbVector limbs((digits.length() + LIMB_DIGITS - 1) / LIMB_DIGITS, 0u);
+    // Walk nine-digit groups from the right; the leftmost group may be shorter
+    std::size_t end = digits.length();
+    for (std::size_t i = 0; i < limbs.size(); i++) {
+        std::size_t begin = end >= static_cast<std::size_t>(LIMB_DIGITS) ? end - LIMB_DIGITS : 0;
+        std::uint32_t limb = 0;
+        for (std::size_t k = begin; k < end; k++) {
+            limb = limb * 10 + static_cast<std::uint32_t>(digits[k] - '0');
+        }
+        limbs[i] = limb;
+        end = begin;
+    }
+    return limbs;
+}
+
+std::string limbsToDigits(const std::uint32_t* limbs, std::size_t length) {
+    while (length > 0 && limbs[length - 1] == 0) {
+        length--;
+    }
+    if (length == 0) {
+        return "0";
+    }
+
+    // Most significant limb unpadded, every lower limb padded to 9 digits
+    std::string digits = std::to_string(limbs[length - 1]);
+    digits.reserve(digits.length() + (length - 1) * LIMB_DIGITS);
+    char buffer[LIMB_DIGITS];
+    for (std::size_t i = length - 1; i-- > 0;) {
+        std::uint32_t limb = limbs[i];
+        for (int d = LIMB_DIGITS; d-- > 0;) {
+            buffer[d] = static_cast<char>('0' + limb % 10);
+            limb /= 10;
+        }
+        digits.append(buffer, LIMB_DIGITS);
+    }
+    return digits;
+}
+
+// out = a * b by rows; out must hold la + lb limbs
+static void multiplySchoolbook(const std::uint32_t* a, std::size_t la, const std::uint32_t* b, std::size_t lb,
+                               std::uint32_t* out) {
+    std::fill(out, out + la + lb, 0u);
+    for (std::size_t i = 0; i < la; i++) {
+        if (a[i] == 0) {
+            continue;
+        }
+        std::uint64_t carry = 0;
+        for (std::size_t j = 0; j < lb; j++) {
+            // < 10^9 + (10^9 - 1)^2 + 10^9, fits in 64 bits
+            std::uint64_t current = out[i + j] + static_cast<std::uint64_t>(a[i]) * b[j] + carry;
+            out[i + j] = static_cast<std::uint32_t>(current % LIMB_BASE);
+            carry = current / LIMB_BASE;
+        }
+        out[i + lb] = static_cast<std::uint32_t>(carry);
+    }
+}
+
+// dst[0 .. dn) += src[0 .. sn), carrying upward (requires dn >= sn and no carry out of dst)
+static void addInto(std::uint32_t* dst, std::size_t dn, const std::uint32_t* src, std::size_t sn) {
+    std::uint32_t carry = 0;
+    std::size_t i = 0;
+    for (; i < sn; i++) {
+        std::uint32_t sum = dst[i] + src[i] + carry;
+        carry = sum >= LIMB_BASE ? 1u : 0u;
+        dst[i] = sum - carry * LIMB_BASE;
+    }
+    for (; carry != 0 && i < dn; i++) {
+        std::uint32_t sum = dst[i] + carry;
+        carry = sum >= LIMB_BASE ? 1u : 0u;
+        dst[i] = sum - carry * LIMB_BASE;
+    }
+}
+
+// dst[0 .. dn) -= src[0 .. sn), borrowing upward (requires dst >= src)
+static void subtractFrom(std::uint32_t* dst, std::size_t dn, const std::uint32_t* src, std::size_t sn) {
+    std::uint32_t borrow = 0;
+    std::size_t i = 0;
+    for (; i < sn; i++) {
+        std::uint32_t subtrahend = src[i] + borrow;
+        borrow = dst[i] < subtrahend ? 1u : 0u;
+        dst[i] = dst[i] + borrow * LIMB_BASE - subtrahend;
+    }
+    for (; borrow != 0 && i < dn; i++) {
+        borrow = dst[i] == 0 ? 1u : 0u;
+        dst[i] = borrow ? LIMB_BASE - 1 : dst[i] - 1;
+    }
+}
+
+// Number of limbs without leading zeros (at least one)
+static std::size_t significantLength(const std::uint32_t* limbs, std::size_t length) {
+    while (length > 1 && limbs[length - 1] == 0) {
+        length--;
+    }
+    return length;
+}
+
+// out = a * b with la >= lb; out must hold la + lb limbs
+static void multiplyKaratsuba(const std::uint32_t* a, std::size_t la, const std::uint32_t* b, std::size_t lb,
+                              std::uint32_t* out) {
+    std::size_t threshold = getKaratsubaThreshold();
+    if (lb < threshold) {
+        multiplySchoolbook(a, la, b, lb, out);
+        return;
+    }
+    CalculationContext::checkpoint(OP_MULTIPLY, 0, 0);
+
+    // Unbalanced operands: multiply b by lb-limb slices of a
+    if (la >= 2 * lb) {
+        std::fill(out, out + la + lb, 0u);
+        LimbVector partial(2 * lb);
+        for (std::size_t offset = 0; offset < la; offset += lb) {
+            std::size_t length = std::min(lb, la - offset);
+            if (length >= lb) {
+                multiplyKaratsuba(a + offset, length, b, lb, partial.data());
+            } else {
+                multiplyKaratsuba(b, lb, a + offset, length, partial.data());
+            }
+            addInto(out + offset, la + lb - offset, partial.data(), length + lb);
+        }
+        return;
+    }
+
+    // a = a1 * B^m + a0, b = b1 * B^m + b0, with lb > m so both high halves are non-empty
+    std::size_t m = la / 2;
+    const std::uint32_t* a0 = a;
+    const std::uint32_t* a1 = a + m;
+    const std::uint32_t* b0 = b;
+    const std::uint32_t* b1 = b + m;
+    std::size_t la1 = la - m;
+    std::size_t lb1 = lb - m;
+
+    // z0 = a0 * b0 lands in out[0 .. 2m), z2 = a1 * b1 in out[2m .. la + lb)
+    multiplyKaratsuba(a0, m, b0, m, out);
+    if (la1 >= lb1) {
+        multiplyKaratsuba(a1, la1, b1, lb1, out + 2 * m);
+    } else {
+        multiplyKaratsuba(b1, lb1, a1, la1, out + 2 * m);
+    }
+
+    // z1 = (a0 + a1)(b0 + b1) - z0 - z2
+    LimbVector sa(la1 + 1, 0u);
+    LimbVector sb(std::max(m, lb1) + 1, 0u);
+    std::copy(a1, a1 + la1, sa.begin());
+    addInto(sa.data(), sa.size(), a0, m);
+    std::copy(b0, b0 + m, sb.begin());
+    addInto(sb.data(), sb.size(), b1, lb1);
+    std::size_t lsa = significantLength(sa.data(), sa.size());
+    std::size_t lsb = significantLength(sb.data(), sb.size());
+
+    LimbVector middle(lsa + lsb);
+    if (lsa >= lsb) {
+        multiplyKaratsuba(sa.data(), lsa, sb.data(), lsb, middle.data());
+    } else {
+        multiplyKaratsuba(sb.data(), lsb, sa.data(), lsa, middle.data());
+    }
+    subtractFrom(middle.data(), middle.size(), out, significantLength(out, 2 * m));
+    subtractFrom(middle.data(), middle.size(), out + 2 * m, significantLength(out + 2 * m, la1 + lb1));
+
+    addInto(out + m, la + lb - m, middle.data(), significantLength(middle.data(), middle.size()));
+}
+
+void multiplyLimbs(const std::uint32_t* a, std::size_t la, const std::uint32_t* b, std::size_t lb,
+                   std::uint32_t* out) {
+    if (la >= lb) {
+        multiplyKaratsuba(a, la, b, lb, out);
+    } else {
+        multiplyKaratsuba(b, lb, a, la, out);
+    }
+}
+
+LimbVector multiplyLimbVectors(const LimbVector& a, const LimbVector& b) {
+    if (a.empty() || b.empty()) {
+        return LimbVector();
+    }
+    LimbVector product(a.size() + b.size());
+    multiplyLimbs(a.data(), a.size(), b.data(), b.size(), product.data());
+    while (!product.empty() && product.back() == 0) {
+        product.pop_back();
+    }
+    return product;
+}
+
+// Product of factors[begin .. end); branches above the tuned factor count run on spare threads
+static LimbVector productRange(const std::vector<std::uint32_t>& factors, std::size_t begin, std::size_t end,
+                               unsigned threads) {
+    if (end - begin <= 16) {
+        // Accumulate small runs with single-limb multiplications
+        LimbVector product(1, 1u);
+        for (std::size_t i = begin; i < end; i++) {
+            std::uint64_t carry = 0;
+            for (std::size_t k = 0; k < product.size(); k++) {
+                std::uint64_t current = static_cast<std::uint64_t>(product[k]) * factors[i] + carry;
+                product[k] = static_cast<std::uint32_t>(current % LIMB_BASE);
+                carry = current / LIMB_BASE;
+            }
+            if (carry != 0) {
+                product.push_back(static_cast<std::uint32_t>(carry));
+            }
+        }
+        return product;
+    }
+
+    std::size_t mid = begin + (end - begin) / 2;
+    if (threads > 1 && end - begin >= TuningConfig::parallelProductFactors()) {
+        unsigned leftThreads = threads / 2;
+        std::future<LimbVector> left = std::async(std::launch::async, productRange, std::cref(factors),
+                                                  begin, mid, leftThreads);
+        LimbVector right = productRange(factors, mid, end, threads - leftThreads);
+        return multiplyLimbVectors(left.get(), right);
+    }
+    return multiplyLimbVectors(productRange(factors, begin, mid, 1), productRange(factors, mid, end, 1));
+}
+
+LimbVector productTree(const std::vector<std::uint32_t>& factors, unsigned threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0) {
+            threadCount = 2;
+        }
+    }
+    if (factors.empty()) {
+        return LimbVector(1, 1u);
+    }
+    return productRange(factors, 0, factors.size(), threadCount);
+}
@@ -0,0 +1,82 @@
+#ifndef LIMB_ARITHMETIC_H
+#define LIMB_ARITHMETIC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+Integer kernels on base-10^9 limb arrays (least significant limb first), shared by BigNumber
+multiplication, BigNumberColumn and the combinatorial functions. Base 10^9 keeps conversion to and
+from BigNumber's decimal digits linear while packing nine digits into each 32-bit word.
+*/
+
+typedef std::vector<std::uint32_t> LimbVector;
+
+const std::uint32_t LIMB_BASE = 1000000000u;
+const int LIMB_DIGITS = 9;
+
+/*
+FUNCTION: Converts an integer digit string to limbs
+INPUT: A digit string (most significant first)
+OUTPUT: LimbVector holding the same value, least significant limb first
+SCALE: O(n)
+LIMITATIONS: Leading zero digits produce leading zero limbs
+DATE: 2026-10-19
+*/
+LimbVector digitsToLimbs(const std::string& digits);
+
+/*
+FUNCTION: Converts limbs to an integer digit string
+INPUT: A limb array and its length
+OUTPUT: std::string without leading zeros ("0" for zero)
+SCALE: O(n)
+LIMITATIONS: None
+DATE: 2026-10-19
+*/
+std::string limbsToDigits(const std::uint32_t* limbs, std::size_t length);
+
+/*
+FUNCTION: Multiplies two limb arrays
+INPUT: Operands a (la limbs) and b (lb limbs), output buffer of la + lb limbs
+OUTPUT: void (out holds a * b)
+SCALE: O(n^2) below the Karatsuba threshold, O(n^1.585) above it
+LIMITATIONS: out must not overlap the operands; polls CalculationContext once per Karatsuba split
+DATE: 2026-10-19
+*/
+void multiplyLimbs(const std::uint32_t* a, std::size_t la, const std::uint32_t* b, std::size_t lb,
+                   std::uint32_t* out);
+
+/*
+FUNCTION: Multiplies two limb vectors
+INPUT: Two LimbVectors
+OUTPUT: LimbVector holding the product without leading zero limbs
+SCALE: See multiplyLimbs
+LIMITATIONS: None
+DATE: 2026-10-19
+*/
+LimbVector multiplyLimbVectors(const LimbVector& a, const LimbVector& b);
+
+/*
+FUNCTION: Multiplies many single-limb factors with a balanced product tree
+INPUT: Factors below 10^9 and the number of threads to use (0 means one per hardware thread)
+OUTPUT: LimbVector holding the product (1 for no factors)
+SCALE: O(M(n) log n) for an n-limb result, with the upper levels of the tree split across threads
+LIMITATIONS: Threads other than the caller do not poll CalculationContext
+DATE: 2026-10-19
+*/
+LimbVector productTree(const std::vector<std::uint32_t>& factors, unsigned threadCount = 0);
+
+/*
+FUNCTION: Reads and sets the operand size (in limbs) where multiplication switches to Karatsuba
+INPUT: Threshold in limbs (values below 2 are raised to 2)
+OUTPUT: Current threshold
+SCALE: O(1)
+LIMITATIONS: Process-wide setting, shared with TuningConfig::karatsubaLimbs
+DATE: 2026-10-19
+*/
+std::size_t getKaratsubaThreshold();
+void setKaratsubaThreshold(std::size_t limbs);
+
+#endif // LIMB_ARITHMETIC_H
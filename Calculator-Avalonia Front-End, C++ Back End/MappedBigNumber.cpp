@@ -0,0 +1,582 @@
+#include "MappedBigNumber.h"
+#include "CalculationContext.h"
+#include "LimbArithmetic.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ---- MappedRegion ----
+
+MappedRegion::MappedRegion() : base(nullptr), mappedLength(0), bytes(nullptr), length(0) {}
+
+MappedRegion::MappedRegion(MappedRegion&& other)
+    : base(other.base), mappedLength(other.mappedLength), bytes(other.bytes), length(other.length) {
+    other.base = nullptr;
+    other.bytes = nullptr;
+    other.mappedLength = 0;
+    other.length = 0;
+}
+
+MappedRegion& MappedRegion::operator=(MappedRegion&& other) {
+    if (this != &other) {
+        release();
+        base = other.base;
+        mappedLength = other.mappedLength;
+        bytes = other.bytes;
+        length = other.length;
+        other.base = nullptr;
+        other.bytes = nullptr;
+        other.mappedLength = 0;
+        other.length = 0;
+    }
+    return *this;
+}
+
+MappedRegion::~MappedRegion() {
+    release();
+}
+
+void MappedRegion::release() {
+    if (base != nullptr) {
+#ifdef _WIN32
+        UnmapViewOfFile(base);
+#else
+        munmap(base, mappedLength);
+#endif
+        base = nullptr;
+    }
+}
+
+// ---- MappedFile ----
+
+// Mapping offsets must be multiples of this
+static std::uint64_t mappingGranularity() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwAllocationGranularity;
+#else
+    return static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+MappedFile::MappedFile(const std::string& path, Mode mode, std::uint64_t size)
+    : filePath(path), writable(mode != READ_ONLY), fileSize(0) {
+#ifdef _WIN32
+    handle = CreateFileA(path.c_str(), GENERIC_READ | (writable ? GENERIC_WRITE : 0), FILE_SHARE_READ, nullptr,
+                         mode == CREATE ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    if (mode == CREATE) {
+        resize(size);
+    } else {
+        LARGE_INTEGER current;
+        if (!GetFileSizeEx(handle, &current)) {
+            CloseHandle(handle);
+            throw std::runtime_error("Cannot read the size of " + path);
+        }
+        fileSize = static_cast<std::uint64_t>(current.QuadPart);
+    }
+#else
+    int flags = mode == READ_ONLY ? O_RDONLY : mode == READ_WRITE ? O_RDWR : (O_RDWR | O_CREAT | O_TRUNC);
+    descriptor = ::open(path.c_str(), flags, 0644);
+    if (descriptor < 0) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    if (mode == CREATE) {
+        try {
+            resize(size);
+        } catch (...) {
+            ::close(descriptor);
+            throw;
+        }
+    } else {
+        struct stat status;
+        if (fstat(descriptor, &status) != 0) {
+            ::close(descriptor);
+            throw std::runtime_error("Cannot read the size of " + path);
+        }
+        fileSize = static_cast<std::uint64_t>(status.st_size);
+    }
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+    CloseHandle(handle);
+#else
+    ::close(descriptor);
+#endif
+}
+
+void MappedFile::resize(std::uint64_t size) {
+#ifdef _WIN32
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(size);
+    if (!SetFilePointerEx(handle, position, nullptr, FILE_BEGIN) || !SetEndOfFile(handle)) {
+        throw std::runtime_error("Cannot resize " + filePath);
+    }
+#else
+    if (ftruncate(descriptor, static_cast<off_t>(size)) != 0) {
+        throw std::runtime_error("Cannot resize " + filePath);
+    }
+#endif
+    fileSize = size;
+}
+
+MappedRegion MappedFile::map(std::uint64_t offset, std::size_t length) {
+    MappedRegion region;
+    if (length == 0) {
+        return region;
+    }
+    if (offset + length > fileSize) {
+        throw std::out_of_range("Mapping past the end of " + filePath);
+    }
+
+    // Map from the aligned offset below the request and point into it
+    std::uint64_t granularity = mappingGranularity();
+    std::uint64_t aligned = offset - offset % granularity;
+    std::size_t mappedLength = static_cast<std::size_t>(offset - aligned) + length;
+#ifdef _WIN32
+    HANDLE mapping = CreateFileMappingA(handle, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        throw std::runtime_error("Cannot map " + filePath);
+    }
+    void* base = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, static_cast<DWORD>(aligned >> 32),
+                               static_cast<DWORD>(aligned & 0xFFFFFFFFu), mappedLength);
+    // The view keeps the mapping object alive
+    CloseHandle(mapping);
+    if (base == nullptr) {
+        throw std::runtime_error("Cannot map " + filePath);
+    }
+#else
+    void* base = mmap(nullptr, mappedLength, PROT_READ | (writable ? PROT_WRITE : 0), MAP_SHARED, descriptor,
+                      static_cast<off_t>(aligned));
+    if (base == MAP_FAILED) {
+        throw std::runtime_error("Cannot map " + filePath);
+    }
+#endif
+    region.base = base;
+    region.mappedLength = mappedLength;
+    region.bytes = static_cast<unsigned char*>(base) + (offset - aligned);
+    region.length = length;
+    return region;
+}
+
+// ---- MappedBigNumber ----
+
+// Limb file header: "BIGNUM01", 64-bit limb count, 32-bit sign flag, 32 reserved bits.
+// The limbs follow, least significant first.
+static const char MAGIC[8] = {'B', 'I', 'G', 'N', 'U', 'M', '0', '1'};
+static const std::size_t HEADER_BYTES = 24;
+static const std::size_t LIMB_BYTES = sizeof(std::uint32_t);
+
+static std::uint64_t limbOffset(std::uint64_t index) {
+    return HEADER_BYTES + index * LIMB_BYTES;
+}
+
+static void writeHeader(MappedFile& file, std::uint64_t limbs, bool negative) {
+    MappedRegion header = file.map(0, HEADER_BYTES);
+    std::uint32_t sign = negative ? 1u : 0u;
+    std::uint32_t reserved = 0;
+    std::memcpy(header.data(), MAGIC, sizeof(MAGIC));
+    std::memcpy(header.data() + 8, &limbs, sizeof(limbs));
+    std::memcpy(header.data() + 16, &sign, sizeof(sign));
+    std::memcpy(header.data() + 20, &reserved, sizeof(reserved));
+}
+
+// Map limbs [first, first + count) of a limb file (count may be zero)
+static MappedRegion mapLimbs(MappedFile& file, std::uint64_t first, std::uint64_t count) {
+    return file.map(limbOffset(first), static_cast<std::size_t>(count * LIMB_BYTES));
+}
+
+static std::uint32_t* limbPointer(const MappedRegion& region) {
+    return reinterpret_cast<std::uint32_t*>(region.data());
+}
+
+// Number of limbs below the highest nonzero one (0 for zero), scanning blocks from the top
+static std::uint64_t trimmedLength(MappedFile& file, std::uint64_t limbs, std::size_t blockLimbs) {
+    std::uint64_t high = limbs;
+    while (high > 0) {
+        std::uint64_t low = high > blockLimbs ? high - blockLimbs : 0;
+        MappedRegion region = mapLimbs(file, low, high - low);
+        const std::uint32_t* block = limbPointer(region);
+        for (std::uint64_t i = high; i > low; i--) {
+            if (block[i - 1 - low] != 0) {
+                return i;
+            }
+        }
+        high = low;
+    }
+    return 0;
+}
+
+// Write the header for the final length and drop the unused top limbs
+static void finishFile(MappedFile& file, std::uint64_t limbs, bool negative, std::size_t blockLimbs) {
+    std::uint64_t length = trimmedLength(file, limbs, blockLimbs);
+    writeHeader(file, length, negative && length != 0);
+    file.resize(limbOffset(length));
+}
+
+static void checkBlockLimbs(std::size_t blockLimbs) {
+    if (blockLimbs == 0) {
+        throw std::invalid_argument("Block size must be at least one limb");
+    }
+}
+
+MappedBigNumber MappedBigNumber::open(const std::string& path) {
+    MappedFile file(path, MappedFile::READ_ONLY);
+    if (file.size() < HEADER_BYTES) {
+        throw std::runtime_error("Not a limb file: " + path);
+    }
+    MappedRegion header = file.map(0, HEADER_BYTES);
+    std::uint64_t limbs = 0;
+    std::uint32_t sign = 0;
+    std::memcpy(&limbs, header.data() + 8, sizeof(limbs));
+    std::memcpy(&sign, header.data() + 16, sizeof(sign));
+    if (std::memcmp(header.data(), MAGIC, sizeof(MAGIC)) != 0 || file.size() < limbOffset(limbs)) {
+        throw std::runtime_error("Not a limb file: " + path);
+    }
+    return MappedBigNumber(path, limbs, sign != 0 && limbs != 0);
+}
+
+MappedBigNumber MappedBigNumber::create(const std::string& path, const BigNumber& value) {
+    std::string text = value.toString();
+    bool negative = !text.empty() && text[0] == '-';
+    std::string digits = negative ? text.substr(1) : text;
+    if (digits.find_first_not_of("0123456789") != std::string::npos) {
+        throw std::invalid_argument("MappedBigNumber holds integers only");
+    }
+
+    LimbVector limbs = digitsToLimbs(digits);
+    while (!limbs.empty() && limbs.back() == 0) {
+        limbs.pop_back();
+    }
+    MappedFile file(path, MappedFile::CREATE, limbOffset(limbs.size()));
+    writeHeader(file, limbs.size(), negative && !limbs.empty());
+    if (!limbs.empty()) {
+        MappedRegion region = mapLimbs(file, 0, limbs.size());
+        std::memcpy(region.data(), limbs.data(), limbs.size() * LIMB_BYTES);
+    }
+    return MappedBigNumber(path, limbs.size(), negative && !limbs.empty());
+}
+
+static bool isSpace(unsigned char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+MappedBigNumber MappedBigNumber::importDecimal(const std::string& textPath, const std::string& path,
+                                               std::size_t blockLimbs) {
+    checkBlockLimbs(blockLimbs);
+    MappedFile text(textPath, MappedFile::READ_ONLY);
+
+    // Locate the digits: optional sign in front, whitespace at the end
+    std::uint64_t start = 0;
+    std::uint64_t end = text.size();
+    bool negative = false;
+    if (end > 0) {
+        MappedRegion first = text.map(0, 1);
+        if (first.data()[0] == '-') {
+            negative = true;
+            start = 1;
+        }
+    }
+    bool trailing = true;
+    while (trailing && end > start) {
+        std::uint64_t low = end - std::min<std::uint64_t>(end - start, 4096);
+        MappedRegion tail = text.map(low, static_cast<std::size_t>(end - low));
+        while (end > low && isSpace(tail.data()[end - 1 - low])) {
+            end--;
+        }
+        trailing = end == low;
+    }
+    if (end == start) {
+        throw std::invalid_argument("No digits in " + textPath);
+    }
+
+    // Limb k holds the digits [end - 9(k + 1), end - 9k)
+    std::uint64_t digitCount = end - start;
+    std::uint64_t limbs = (digitCount + LIMB_DIGITS - 1) / LIMB_DIGITS;
+    MappedFile file(path, MappedFile::CREATE, limbOffset(limbs));
+    for (std::uint64_t low = 0; low < limbs; low += blockLimbs) {
+        CalculationContext::checkpoint(OP_PARSE, static_cast<std::size_t>(low), static_cast<std::size_t>(limbs));
+        std::uint64_t high = std::min<std::uint64_t>(limbs, low + blockLimbs);
+        std::uint64_t textLow = end - std::min<std::uint64_t>(digitCount, high * LIMB_DIGITS);
+        std::uint64_t textHigh = end - low * LIMB_DIGITS;
+        MappedRegion digits = text.map(textLow, static_cast<std::size_t>(textHigh - textLow));
+        MappedRegion region = mapLimbs(file, low, high - low);
+        std::uint32_t* block = limbPointer(region);
+
+        for (std::uint64_t k = low; k < high; k++) {
+            std::uint64_t digitHigh = end - k * LIMB_DIGITS;
+            std::uint64_t digitLow = digitHigh - std::min<std::uint64_t>(digitHigh - start, LIMB_DIGITS);
+            std::uint32_t limb = 0;
+            for (std::uint64_t d = digitLow; d < digitHigh; d++) {
+                unsigned char c = digits.data()[d - textLow];
+                if (c < '0' || c > '9') {
+                    throw std::invalid_argument("Invalid digit in " + textPath);
+                }
+                limb = limb * 10 + (c - '0');
+            }
+            block[k - low] = limb;
+        }
+    }
+
+    finishFile(file, limbs, negative, blockLimbs);
+    return open(path);
+}
+
+void MappedBigNumber::exportDecimal(const std::string& textPath, std::size_t blockLimbs) const {
+    checkBlockLimbs(blockLimbs);
+    MappedFile file(filePath, MappedFile::READ_ONLY);
+    if (limbs == 0) {
+        MappedFile text(textPath, MappedFile::CREATE, 1);
+        text.map(0, 1).data()[0] = '0';
+        return;
+    }
+
+    // The top limb is written without leading zeros, every other limb as nine digits
+    std::uint32_t top = 0;
+    {
+        MappedRegion region = mapLimbs(file, limbs - 1, 1);
+        top = limbPointer(region)[0];
+    }
+    std::string head = (negative ? "-" : "") + std::to_string(top);
+    std::uint64_t length = head.length() + (limbs - 1) * LIMB_DIGITS;
+    MappedFile text(textPath, MappedFile::CREATE, length);
+    {
+        MappedRegion region = text.map(0, head.length());
+        std::memcpy(region.data(), head.data(), head.length());
+    }
+
+    // Walk the remaining limbs from the top so the text is written front to back
+    std::uint64_t high = limbs - 1;
+    while (high > 0) {
+        CalculationContext::checkpoint(OP_TO_STRING, static_cast<std::size_t>(limbs - high),
+                                       static_cast<std::size_t>(limbs));
+        std::uint64_t low = high > blockLimbs ? high - blockLimbs : 0;
+        MappedRegion region = mapLimbs(file, low, high - low);
+        const std::uint32_t* block = limbPointer(region);
+        MappedRegion out = text.map(head.length() + (limbs - 1 - high) * LIMB_DIGITS,
+                                    static_cast<std::size_t>((high - low) * LIMB_DIGITS));
+        unsigned char* position = out.data();
+        for (std::uint64_t k = high; k > low; k--) {
+            std::uint32_t limb = block[k - 1 - low];
+            for (int d = LIMB_DIGITS - 1; d >= 0; d--) {
+                position[d] = static_cast<unsigned char>('0' + limb % 10);
+                limb /= 10;
+            }
+            position += LIMB_DIGITS;
+        }
+        high = low;
+    }
+}
+
+BigNumber MappedBigNumber::toBigNumber() const {
+    if (limbs == 0) {
+        return BigNumber();
+    }
+    MappedFile file(filePath, MappedFile::READ_ONLY);
+    MappedRegion region = mapLimbs(file, 0, limbs);
+    std::string digits = limbsToDigits(limbPointer(region), static_cast<std::size_t>(limbs));
+    return BigNumber(negative ? "-" + digits : digits);
+}
+
+int MappedBigNumber::compareMagnitudes(const MappedBigNumber& a, const MappedBigNumber& b, std::size_t blockLimbs) {
+    if (a.limbs != b.limbs) {
+        return a.limbs < b.limbs ? -1 : 1;
+    }
+    MappedFile fileA(a.filePath, MappedFile::READ_ONLY);
+    MappedFile fileB(b.filePath, MappedFile::READ_ONLY);
+    std::uint64_t high = a.limbs;
+    while (high > 0) {
+        std::uint64_t low = high > blockLimbs ? high - blockLimbs : 0;
+        MappedRegion regionA = mapLimbs(fileA, low, high - low);
+        MappedRegion regionB = mapLimbs(fileB, low, high - low);
+        const std::uint32_t* blockA = limbPointer(regionA);
+        const std::uint32_t* blockB = limbPointer(regionB);
+        for (std::uint64_t i = high - low; i > 0; i--) {
+            if (blockA[i - 1] != blockB[i - 1]) {
+                return blockA[i - 1] < blockB[i - 1] ? -1 : 1;
+            }
+        }
+        high = low;
+    }
+    return 0;
+}
+
+int MappedBigNumber::compare(const MappedBigNumber& a, const MappedBigNumber& b, std::size_t blockLimbs) {
+    checkBlockLimbs(blockLimbs);
+    if (a.negative != b.negative) {
+        return a.negative ? -1 : 1;
+    }
+    int magnitude = compareMagnitudes(a, b, blockLimbs);
+    return a.negative ? -magnitude : magnitude;
+}
+
+static void checkOutputPath(const std::string& outPath, const MappedBigNumber& a, const MappedBigNumber& b) {
+    if (outPath == a.path() || outPath == b.path()) {
+        throw std::invalid_argument("Output file must differ from the operand files");
+    }
+}
+
+MappedBigNumber MappedBigNumber::add(const MappedBigNumber& a, const MappedBigNumber& b, const std::string& outPath,
+                                     std::size_t blockLimbs) {
+    return addSigned(a, b, false, outPath, blockLimbs);
+}
+
+MappedBigNumber MappedBigNumber::subtract(const MappedBigNumber& a, const MappedBigNumber& b,
+                                          const std::string& outPath, std::size_t blockLimbs) {
+    return addSigned(a, b, true, outPath, blockLimbs);
+}
+
+MappedBigNumber MappedBigNumber::addSigned(const MappedBigNumber& a, const MappedBigNumber& b, bool negateB,
+                                           const std::string& outPath, std::size_t blockLimbs) {
+    checkBlockLimbs(blockLimbs);
+    checkOutputPath(outPath, a, b);
+    bool negativeB = (b.negative != negateB) && b.limbs != 0;
+
+    if (a.negative == negativeB || a.limbs == 0 || b.limbs == 0) {
+        // Same signs (or a zero operand): add magnitudes, one block at a time with a running carry
+        bool negative = a.limbs != 0 ? a.negative : negativeB;
+        std::uint64_t length = std::max(a.limbs, b.limbs) + 1;
+        MappedFile fileA(a.filePath, MappedFile::READ_ONLY);
+        MappedFile fileB(b.filePath, MappedFile::READ_ONLY);
+        MappedFile out(outPath, MappedFile::CREATE, limbOffset(length));
+        std::uint32_t carry = 0;
+        for (std::uint64_t low = 0; low < length; low += blockLimbs) {
+            CalculationContext::checkpoint(OP_ADD, static_cast<std::size_t>(low), static_cast<std::size_t>(length));
+            std::uint64_t high = std::min<std::uint64_t>(length, low + blockLimbs);
+            std::uint64_t endA = std::max(low, std::min(high, a.limbs));
+            std::uint64_t endB = std::max(low, std::min(high, b.limbs));
+            MappedRegion regionA = mapLimbs(fileA, low, endA - low);
+            MappedRegion regionB = mapLimbs(fileB, low, endB - low);
+            MappedRegion regionOut = mapLimbs(out, low, high - low);
+            const std::uint32_t* blockA = limbPointer(regionA);
+            const std::uint32_t* blockB = limbPointer(regionB);
+            std::uint32_t* blockOut = limbPointer(regionOut);
+            for (std::uint64_t i = low; i < high; i++) {
+                std::uint32_t sum = carry;
+                sum += i < endA ? blockA[i - low] : 0u;
+                sum += i < endB ? blockB[i - low] : 0u;
+                carry = sum >= LIMB_BASE ? 1u : 0u;
+                blockOut[i - low] = sum - carry * LIMB_BASE;
+            }
+        }
+        finishFile(out, length, negative, blockLimbs);
+        return open(outPath);
+    }
+
+    // Opposite signs: subtract the smaller magnitude from the larger with a running borrow
+    int magnitude = compareMagnitudes(a, b, blockLimbs);
+    if (magnitude == 0) {
+        MappedFile out(outPath, MappedFile::CREATE, HEADER_BYTES);
+        writeHeader(out, 0, false);
+        return MappedBigNumber(outPath, 0, false);
+    }
+    const MappedBigNumber& larger = magnitude > 0 ? a : b;
+    const MappedBigNumber& smaller = magnitude > 0 ? b : a;
+    bool negative = magnitude > 0 ? a.negative : negativeB;
+    std::uint64_t length = larger.limbs;
+    MappedFile fileLarger(larger.filePath, MappedFile::READ_ONLY);
+    MappedFile fileSmaller(smaller.filePath, MappedFile::READ_ONLY);
+    MappedFile out(outPath, MappedFile::CREATE, limbOffset(length));
+    std::uint32_t borrow = 0;
+    for (std::uint64_t low = 0; low < length; low += blockLimbs) {
+        CalculationContext::checkpoint(OP_SUBTRACT, static_cast<std::size_t>(low), static_cast<std::size_t>(length));
+        std::uint64_t high = std::min<std::uint64_t>(length, low + blockLimbs);
+        std::uint64_t endSmaller = std::max(low, std::min(high, smaller.limbs));
+        MappedRegion regionLarger = mapLimbs(fileLarger, low, high - low);
+        MappedRegion regionSmaller = mapLimbs(fileSmaller, low, endSmaller - low);
+        MappedRegion regionOut = mapLimbs(out, low, high - low);
+        const std::uint32_t* blockLarger = limbPointer(regionLarger);
+        const std::uint32_t* blockSmaller = limbPointer(regionSmaller);
+        std::uint32_t* blockOut = limbPointer(regionOut);
+        for (std::uint64_t i = low; i < high; i++) {
+            std::uint32_t subtrahend = (i < endSmaller ? blockSmaller[i - low] : 0u) + borrow;
+            std::uint32_t minuend = blockLarger[i - low];
+            borrow = minuend < subtrahend ? 1u : 0u;
+            blockOut[i - low] = minuend + borrow * LIMB_BASE - subtrahend;
+        }
+    }
+    finishFile(out, length, negative, blockLimbs);
+    return open(outPath);
+}
+
+// Add limbs into out[offset ..], carrying as far as needed
+static void addIntoFile(MappedFile& out, std::uint64_t outLimbs, std::uint64_t offset, const std::uint32_t* limbs,
+                        std::size_t count, std::size_t blockLimbs) {
+    std::uint32_t carry = 0;
+    {
+        MappedRegion region = mapLimbs(out, offset, count);
+        std::uint32_t* block = limbPointer(region);
+        for (std::size_t i = 0; i < count; i++) {
+            std::uint32_t sum = block[i] + limbs[i] + carry;
+            carry = sum >= LIMB_BASE ? 1u : 0u;
+            block[i] = sum - carry * LIMB_BASE;
+        }
+    }
+    // Partial products never exceed the full product, so the carry stops inside the file
+    std::uint64_t position = offset + count;
+    while (carry != 0 && position < outLimbs) {
+        std::uint64_t high = std::min<std::uint64_t>(outLimbs, position + blockLimbs);
+        MappedRegion region = mapLimbs(out, position, high - position);
+        std::uint32_t* block = limbPointer(region);
+        for (std::uint64_t i = 0; carry != 0 && i < high - position; i++) {
+            std::uint32_t sum = block[i] + carry;
+            carry = sum >= LIMB_BASE ? 1u : 0u;
+            block[i] = sum - carry * LIMB_BASE;
+        }
+        position = high;
+    }
+}
+
+MappedBigNumber MappedBigNumber::multiply(const MappedBigNumber& a, const MappedBigNumber& b,
+                                          const std::string& outPath, std::size_t blockLimbs) {
+    checkBlockLimbs(blockLimbs);
+    checkOutputPath(outPath, a, b);
+    if (a.limbs == 0 || b.limbs == 0) {
+        MappedFile out(outPath, MappedFile::CREATE, HEADER_BYTES);
+        writeHeader(out, 0, false);
+        return MappedBigNumber(outPath, 0, false);
+    }
+
+    // Multiply every pair of blocks in memory and accumulate the block product into the output,
+    // walking b and the output sequentially for each block of a
+    std::uint64_t length = a.limbs + b.limbs;
+    MappedFile fileA(a.filePath, MappedFile::READ_ONLY);
+    MappedFile fileB(b.filePath, MappedFile::READ_ONLY);
+    MappedFile out(outPath, MappedFile::CREATE, limbOffset(length));
+    LimbVector product(2 * blockLimbs);
+    std::uint64_t blocksA = (a.limbs + blockLimbs - 1) / blockLimbs;
+    std::uint64_t blocksB = (b.limbs + blockLimbs - 1) / blockLimbs;
+    for (std::uint64_t i = 0; i < blocksA; i++) {
+        std::uint64_t lowA = i * blockLimbs;
+        std::size_t countA = static_cast<std::size_t>(std::min<std::uint64_t>(blockLimbs, a.limbs - lowA));
+        MappedRegion regionA = mapLimbs(fileA, lowA, countA);
+        for (std::uint64_t j = 0; j < blocksB; j++) {
+            CalculationContext::checkpoint(OP_MULTIPLY, static_cast<std::size_t>(i * blocksB + j),
+                                           static_cast<std::size_t>(blocksA * blocksB));
+            std::uint64_t lowB = j * blockLimbs;
+            std::size_t countB = static_cast<std::size_t>(std::min<std::uint64_t>(blockLimbs, b.limbs - lowB));
+            MappedRegion regionB = mapLimbs(fileB, lowB, countB);
+            multiplyLimbs(limbPointer(regionA), countA, limbPointer(regionB), countB, product.data());
+            addIntoFile(out, length, lowA + lowB, product.data(), countA + countB, blockLimbs);
+        }
+    }
+    finishFile(out, length, a.negative != b.negative, blockLimbs);
+    return open(outPath);
+}
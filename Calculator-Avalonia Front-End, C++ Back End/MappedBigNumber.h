@@ -0,0 +1,145 @@
+#ifndef MAPPED_BIG_NUMBER_H
+#define MAPPED_BIG_NUMBER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "BigNumber.h"
+
+/*
+CLASS: MappedRegion
+PURPOSE: One memory-mapped window of a file, unmapped when the object is destroyed
+OPERATIONS: data() points at the first requested byte; move-only
+DATE: 2026-10-19
+*/
+class MappedRegion {
+public:
+    MappedRegion();
+    MappedRegion(MappedRegion&& other);
+    MappedRegion& operator=(MappedRegion&& other);
+    ~MappedRegion();
+
+    unsigned char* data() const { return bytes; }
+    std::size_t size() const { return length; }
+
+private:
+    friend class MappedFile;
+
+    MappedRegion(const MappedRegion&) = delete;
+    MappedRegion& operator=(const MappedRegion&) = delete;
+
+    void release();
+
+    void* base;             // Start of the mapping (aligned to the allocation granularity)
+    std::size_t mappedLength;
+    unsigned char* bytes;   // First requested byte inside the mapping
+    std::size_t length;
+};
+
+/*
+CLASS: MappedFile
+PURPOSE: Local file that is read and written through memory-mapped windows, so only the windows in
+         use occupy address space and resident memory
+OPERATIONS: Open read-only or read-write, create with a size, resize, map a byte range
+LIMITATIONS: POSIX mmap or Win32 file mappings; resize fails on Windows while windows are mapped.
+             Errors throw std::runtime_error naming the file.
+DATE: 2026-10-19
+*/
+class MappedFile {
+public:
+    enum Mode { READ_ONLY, READ_WRITE, CREATE };
+
+    // Open a file; CREATE truncates or creates it with size bytes (zero-filled)
+    MappedFile(const std::string& path, Mode mode, std::uint64_t size = 0);
+    ~MappedFile();
+
+    std::uint64_t size() const { return fileSize; }
+    const std::string& path() const { return filePath; }
+
+    // Change the file size; new bytes read as zero
+    void resize(std::uint64_t size);
+
+    // Map bytes [offset, offset + length); writable unless the file was opened READ_ONLY
+    MappedRegion map(std::uint64_t offset, std::size_t length);
+
+private:
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string filePath;
+    bool writable;
+    std::uint64_t fileSize;
+#ifdef _WIN32
+    void* handle;
+#else
+    int descriptor;
+#endif
+};
+
+/*
+CLASS: MappedBigNumber
+PURPOSE: Signed integer whose base-10^9 limbs live in a file instead of memory, for values with billions
+         of digits. Addition, subtraction, comparison and multiplication stream over the files in blocks
+         of limbs, so resident memory stays bounded by a few blocks and the files are read sequentially.
+OPERATIONS: Create from a BigNumber or import a decimal text file; open an existing limb file; export as
+            decimal text or load back as a BigNumber; compare, add, subtract, multiply into a new file
+LIMITATIONS: Integers only. Multiplication is block-wise Karatsuba, so its cost is quadratic in the
+             number of blocks. Results go to a new file that must differ from the operands' files.
+             Long passes poll CalculationContext once per block. Limb files use native byte order.
+DATE: 2026-10-19
+*/
+class MappedBigNumber {
+public:
+    // Limbs per block in streaming passes (64 Ki limbs = 256 KB windows)
+    static const std::size_t DEFAULT_BLOCK_LIMBS = 65536;
+
+    // Open an existing limb file
+    static MappedBigNumber open(const std::string& path);
+
+    // Write an integer BigNumber to a new limb file (throws std::invalid_argument for fractions)
+    static MappedBigNumber create(const std::string& path, const BigNumber& value);
+
+    // Convert a decimal text file ("[-]digits", optional trailing whitespace) to a limb file
+    static MappedBigNumber importDecimal(const std::string& textPath, const std::string& path,
+                                         std::size_t blockLimbs = DEFAULT_BLOCK_LIMBS);
+
+    // Write the value as decimal text
+    void exportDecimal(const std::string& textPath, std::size_t blockLimbs = DEFAULT_BLOCK_LIMBS) const;
+
+    // Load the whole value into memory (only sensible for values that fit)
+    BigNumber toBigNumber() const;
+
+    const std::string& path() const { return filePath; }
+    std::uint64_t limbCount() const { return limbs; }
+    bool isNegative() const { return negative; }
+    bool isZero() const { return limbs == 0; }
+
+    // Returns -1, 0 or 1
+    static int compare(const MappedBigNumber& a, const MappedBigNumber& b,
+                       std::size_t blockLimbs = DEFAULT_BLOCK_LIMBS);
+
+    // Arithmetic into a new file at outPath
+    static MappedBigNumber add(const MappedBigNumber& a, const MappedBigNumber& b, const std::string& outPath,
+                               std::size_t blockLimbs = DEFAULT_BLOCK_LIMBS);
+    static MappedBigNumber subtract(const MappedBigNumber& a, const MappedBigNumber& b, const std::string& outPath,
+                                    std::size_t blockLimbs = DEFAULT_BLOCK_LIMBS);
+    static MappedBigNumber multiply(const MappedBigNumber& a, const MappedBigNumber& b, const std::string& outPath,
+                                    std::size_t blockLimbs = DEFAULT_BLOCK_LIMBS);
+
+private:
+    MappedBigNumber(const std::string& path, std::uint64_t limbs, bool negative)
+        : filePath(path), limbs(limbs), negative(negative) {}
+
+    // Shared by add and subtract (b's sign flipped when subtracting)
+    static MappedBigNumber addSigned(const MappedBigNumber& a, const MappedBigNumber& b, bool negateB,
+                                     const std::string& outPath, std::size_t blockLimbs);
+
+    // Compare magnitudes
+    static int compareMagnitudes(const MappedBigNumber& a, const MappedBigNumber& b, std::size_t blockLimbs);
+
+    std::string filePath;
+    std::uint64_t limbs;
+    bool negative;
+};
+
+#endif // MAPPED_BIG_NUMBER_H
@@ -0,0 +1,48 @@
+#ifndef NUMBER_FORMAT_H
+#define NUMBER_FORMAT_H
+
+#include <cstddef>
+
+/*
+STRUCT: NumberFormat
+PURPOSE: Display options for BigNumber::toString(const NumberFormat&): notation, significant digits
+         (rounded half away from zero) and digit grouping of the integer part
+DATE: 2026-10-19
+*/
+struct NumberFormat {
+    enum Notation {
+        PLAIN,        // 1234567.89
+        SCIENTIFIC,   // 1.23456789e6
+        ENGINEERING   // 1.23456789e6 with the exponent a multiple of three (123.456e3)
+    };
+
+    Notation notation;
+    std::size_t significantDigits;  // 0 keeps every digit
+    char groupSeparator;            // Separator between digit groups of the integer part ('\0' for none)
+    std::size_t groupSize;          // Digits per group
+
+    // Defaults: plain notation, every digit, no grouping (the same text as toString())
+    NumberFormat() : notation(PLAIN), significantDigits(0), groupSeparator('\0'), groupSize(3) {}
+
+    static NumberFormat scientific(std::size_t digits) {
+        NumberFormat format;
+        format.notation = SCIENTIFIC;
+        format.significantDigits = digits;
+        return format;
+    }
+
+    static NumberFormat engineering(std::size_t digits) {
+        NumberFormat format;
+        format.notation = ENGINEERING;
+        format.significantDigits = digits;
+        return format;
+    }
+
+    static NumberFormat grouped(char separator = ',') {
+        NumberFormat format;
+        format.groupSeparator = separator;
+        return format;
+    }
+};
+
+#endif // NUMBER_FORMAT_H
@@ -0,0 +1,247 @@
+#include "PerformanceCounters.h"
+#include <sstream>
+
+namespace {
+
+// Raw counters for one operation
+struct OperationCounters {
+    std::atomic<unsigned long long> calls;
+    std::atomic<unsigned long long> totalNanos;
+    std::atomic<unsigned long long> bytesAllocated;
+    std::atomic<unsigned long long> sizeHistogram[PerformanceCounters::SIZE_BUCKETS];
+    std::atomic<unsigned long long> sizeNanos[PerformanceCounters::SIZE_BUCKETS];
+    std::atomic<unsigned long long> latencyHistogram[PerformanceCounters::LATENCY_BUCKETS];
+};
+
+// Static storage is zero-initialized before any dynamic initialization
+OperationCounters counters[OP_COUNT];
+std::atomic<unsigned long long> liveWorkingBytes(0);
+std::atomic<unsigned long long> peakWorkingBytes(0);
+
+// Index of the highest set bit, clamped to the number of buckets
+int log2Bucket(unsigned long long value, int bucketCount) {
+    int bucket = 0;
+    while (value > 1 && bucket < bucketCount - 1) {
+        value >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+// Lower bound of a log2 bucket
+unsigned long long bucketLowerBound(int bucket) {
+    return bucket == 0 ? 0 : (1ULL << bucket);
+}
+
+// Exclusive upper bound of a log2 bucket
+unsigned long long bucketUpperBound(int bucket) {
+    return 1ULL << (bucket + 1);
+}
+
+} // namespace
+
+std::atomic<bool> PerformanceCounters::enabled(false);
+
+// Turn recording on or off at runtime
+void PerformanceCounters::setEnabled(bool on) {
+    enabled.store(on, std::memory_order_relaxed);
+}
+
+// Record one completed operation
+void PerformanceCounters::record(CalcOperation op, std::size_t operandDigits, unsigned long long nanos,
+                                 std::size_t bytesAllocated) {
+    if (op < 0 || op >= OP_COUNT) {
+        return;
+    }
+
+    OperationCounters& c = counters[op];
+    int sizeBucket = log2Bucket(operandDigits, SIZE_BUCKETS);
+    int latencyBucket = log2Bucket(nanos, LATENCY_BUCKETS);
+
+    c.calls.fetch_add(1, std::memory_order_relaxed);
+    c.totalNanos.fetch_add(nanos, std::memory_order_relaxed);
+    c.bytesAllocated.fetch_add(bytesAllocated, std::memory_order_relaxed);
+    c.sizeHistogram[sizeBucket].fetch_add(1, std::memory_order_relaxed);
+    c.sizeNanos[sizeBucket].fetch_add(nanos, std::memory_order_relaxed);
+    c.latencyHistogram[latencyBucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+// Track working memory entering use (updates the peak)
+void PerformanceCounters::acquireWorkingBytes(std::size_t bytes) {
+    unsigned long long live = liveWorkingBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    unsigned long long peak = peakWorkingBytes.load(std::memory_order_relaxed);
+    while (live > peak && !peakWorkingBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        // peak was reloaded by compare_exchange_weak; retry while we are still higher
+    }
+}
+
+// Track working memory leaving use
+void PerformanceCounters::releaseWorkingBytes(std::size_t bytes) {
+    liveWorkingBytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+// Zero every counter
+void PerformanceCounters::reset() {
+    for (int op = 0; op < OP_COUNT; op++) {
+        OperationCounters& c = counters[op];
+        c.calls.store(0, std::memory_order_relaxed);
+        c.totalNanos.store(0, std::memory_order_relaxed);
+        c.bytesAllocated.store(0, std::memory_order_relaxed);
+        for (int i = 0; i < SIZE_BUCKETS; i++) {
+            c.sizeHistogram[i].store(0, std::memory_order_relaxed);
+            c.sizeNanos[i].store(0, std::memory_order_relaxed);
+        }
+        for (int i = 0; i < LATENCY_BUCKETS; i++) {
+            c.latencyHistogram[i].store(0, std::memory_order_relaxed);
+        }
+    }
+    peakWorkingBytes.store(liveWorkingBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+// Copy the current counters
+PerformanceCounters::Snapshot PerformanceCounters::snapshot() {
+    Snapshot snap;
+    for (int op = 0; op < OP_COUNT; op++) {
+        const OperationCounters& c = counters[op];
+        OperationSnapshot& s = snap.operations[op];
+        s.calls = c.calls.load(std::memory_order_relaxed);
+        s.totalNanos = c.totalNanos.load(std::memory_order_relaxed);
+        s.bytesAllocated = c.bytesAllocated.load(std::memory_order_relaxed);
+        for (int i = 0; i < SIZE_BUCKETS; i++) {
+            s.sizeHistogram[i] = c.sizeHistogram[i].load(std::memory_order_relaxed);
+            s.sizeNanos[i] = c.sizeNanos[i].load(std::memory_order_relaxed);
+        }
+        for (int i = 0; i < LATENCY_BUCKETS; i++) {
+            s.latencyHistogram[i] = c.latencyHistogram[i].load(std::memory_order_relaxed);
+        }
+    }
+    snap.peakWorkingBytes = peakWorkingBytes.load(std::memory_order_relaxed);
+    return snap;
+}
+
+// Export the current counters as a JSON document
+std::string PerformanceCounters::toJson() {
+    Snapshot snap = snapshot();
+    std::ostringstream out;
+
+    out << "{\"peakWorkingBytes\":" << snap.peakWorkingBytes << ",\"operations\":{";
+    bool firstOp = true;
+    for (int op = 0; op < OP_COUNT; op++) {
+        const OperationSnapshot& s = snap.operations[op];
+        if (!firstOp) out << ",";
+        firstOp = false;
+
+        out << "\"" << operationName(static_cast<CalcOperation>(op)) << "\":{"
+            << "\"calls\":" << s.calls
+            << ",\"totalNanos\":" << s.totalNanos
+            << ",\"bytesAllocated\":" << s.bytesAllocated;
+
+        // Only non-empty buckets are listed to keep the document small
+        out << ",\"operandDigits\":[";
+        bool first = true;
+        for (int i = 0; i < SIZE_BUCKETS; i++) {
+            if (s.sizeHistogram[i] == 0) continue;
+            if (!first) out << ",";
+            first = false;
+            out << "{\"min\":" << bucketLowerBound(i) << ",\"max\":" << bucketUpperBound(i)
+                << ",\"calls\":" << s.sizeHistogram[i] << ",\"totalNanos\":" << s.sizeNanos[i] << "}";
+        }
+        out << "],\"latencyNanos\":[";
+        first = true;
+        for (int i = 0; i < LATENCY_BUCKETS; i++) {
+            if (s.latencyHistogram[i] == 0) continue;
+            if (!first) out << ",";
+            first = false;
+            out << "{\"min\":" << bucketLowerBound(i) << ",\"max\":" << bucketUpperBound(i)
+                << ",\"calls\":" << s.latencyHistogram[i] << "}";
+        }
+        out << "]}";
+    }
+    out << "}}";
+    return out.str();
+}
+
+// Export the current counters in Prometheus text exposition format
+std::string PerformanceCounters::toPrometheus() {
+    Snapshot snap = snapshot();
+    std::ostringstream out;
+
+    out << "# HELP bignumber_operation_calls_total Completed calculator operations.\n"
+        << "# TYPE bignumber_operation_calls_total counter\n";
+    for (int op = 0; op < OP_COUNT; op++) {
+        out << "bignumber_operation_calls_total{op=\"" << operationName(static_cast<CalcOperation>(op))
+            << "\"} " << snap.operations[op].calls << "\n";
+    }
+
+    out << "# HELP bignumber_operation_bytes_allocated_total Estimated working bytes allocated.\n"
+        << "# TYPE bignumber_operation_bytes_allocated_total counter\n";
+    for (int op = 0; op < OP_COUNT; op++) {
+        out << "bignumber_operation_bytes_allocated_total{op=\"" << operationName(static_cast<CalcOperation>(op))
+            << "\"} " << snap.operations[op].bytesAllocated << "\n";
+    }
+
+    out << "# HELP bignumber_operation_latency_seconds Operation latency.\n"
+        << "# TYPE bignumber_operation_latency_seconds histogram\n";
+    for (int op = 0; op < OP_COUNT; op++) {
+        const OperationSnapshot& s = snap.operations[op];
+        const char* name = operationName(static_cast<CalcOperation>(op));
+        unsigned long long cumulative = 0;
+        for (int i = 0; i < LATENCY_BUCKETS; i++) {
+            cumulative += s.latencyHistogram[i];
+            out << "bignumber_operation_latency_seconds_bucket{op=\"" << name << "\",le=\""
+                << static_cast<double>(bucketUpperBound(i)) * 1e-9 << "\"} " << cumulative << "\n";
+        }
+        out << "bignumber_operation_latency_seconds_bucket{op=\"" << name << "\",le=\"+Inf\"} " << s.calls << "\n"
+            << "bignumber_operation_latency_seconds_sum{op=\"" << name << "\"} "
+            << static_cast<double>(s.totalNanos) * 1e-9 << "\n"
+            << "bignumber_operation_latency_seconds_count{op=\"" << name << "\"} " << s.calls << "\n";
+    }
+
+    out << "# HELP bignumber_operand_digits Largest operand size per operation, in decimal digits.\n"
+        << "# TYPE bignumber_operand_digits histogram\n";
+    for (int op = 0; op < OP_COUNT; op++) {
+        const OperationSnapshot& s = snap.operations[op];
+        const char* name = operationName(static_cast<CalcOperation>(op));
+        unsigned long long cumulative = 0;
+        for (int i = 0; i < SIZE_BUCKETS; i++) {
+            cumulative += s.sizeHistogram[i];
+            out << "bignumber_operand_digits_bucket{op=\"" << name << "\",le=\""
+                << bucketUpperBound(i) - 1 << "\"} " << cumulative << "\n";
+        }
+        out << "bignumber_operand_digits_bucket{op=\"" << name << "\",le=\"+Inf\"} " << s.calls << "\n"
+            << "bignumber_operand_digits_count{op=\"" << name << "\"} " << s.calls << "\n";
+    }
+
+    out << "# HELP bignumber_operation_seconds_by_size_total Time spent per operand-size bucket.\n"
+        << "# TYPE bignumber_operation_seconds_by_size_total counter\n";
+    for (int op = 0; op < OP_COUNT; op++) {
+        const OperationSnapshot& s = snap.operations[op];
+        for (int i = 0; i < SIZE_BUCKETS; i++) {
+            if (s.sizeHistogram[i] == 0) continue;
+            out << "bignumber_operation_seconds_by_size_total{op=\"" << operationName(static_cast<CalcOperation>(op))
+                << "\",max_digits=\"" << bucketUpperBound(i) - 1 << "\"} "
+                << static_cast<double>(s.sizeNanos[i]) * 1e-9 << "\n";
+        }
+    }
+
+    out << "# HELP bignumber_peak_working_bytes Peak estimated working memory across concurrent operations.\n"
+        << "# TYPE bignumber_peak_working_bytes gauge\n"
+        << "bignumber_peak_working_bytes " << snap.peakWorkingBytes << "\n";
+
+    return out.str();
+}
+
+// Short lowercase name of an operation ("add", "sqrt", ...)
+const char* PerformanceCounters::operationName(CalcOperation op) {
+    switch (op) {
+        case OP_PREPROCESS: return "preprocess";
+        case OP_PARSE: return "parse";
+        case OP_TO_STRING: return "to_string";
+        case OP_ADD: return "add";
+        case OP_SUBTRACT: return "subtract";
+        case OP_MULTIPLY: return "multiply";
+        case OP_DIVIDE: return "divide";
+        case OP_SQRT: return "sqrt";
+        default: return "unknown";
+    }
+}
@@ -0,0 +1,139 @@
+#ifndef PERFORMANCE_COUNTERS_H
+#define PERFORMANCE_COUNTERS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+// Operations tracked by the instrumentation layer
+enum CalcOperation {
+    OP_PREPROCESS,
+    OP_PARSE,
+    OP_TO_STRING,
+    OP_ADD,
+    OP_SUBTRACT,
+    OP_MULTIPLY,
+    OP_DIVIDE,
+    OP_SQRT,
+    OP_COUNT
+};
+
+/*
+CLASS: PerformanceCounters
+PURPOSE: Process-wide, lock-free counters and histograms for calculator operations
+OPERATIONS: Per-operation call counts, operand-size histograms (log2 of digit count), time spent per
+            operand-size bucket, latency histograms (log2 of nanoseconds), working bytes allocated and
+            peak working memory. Snapshots can be exported as JSON or Prometheus text format.
+LIMITATIONS: Disabled by default; when disabled each instrumented call costs one relaxed atomic load.
+             Building with -DBIGNUMBER_NO_METRICS removes the instrumentation entirely.
+             Nested operations (e.g. the subtractions inside a division) are recorded as well, so
+             times are inclusive. Byte figures are estimates of working buffers, not heap totals.
+DATE: 2026-10-19
+*/
+class PerformanceCounters {
+public:
+    static const int SIZE_BUCKETS = 32;     // Bucket i holds operand sizes in [2^i, 2^(i+1)) digits
+    static const int LATENCY_BUCKETS = 40;  // Bucket i holds latencies in [2^i, 2^(i+1)) nanoseconds
+
+    // Counters for one operation at snapshot time
+    struct OperationSnapshot {
+        unsigned long long calls;
+        unsigned long long totalNanos;
+        unsigned long long bytesAllocated;
+        unsigned long long sizeHistogram[SIZE_BUCKETS];
+        unsigned long long sizeNanos[SIZE_BUCKETS];
+        unsigned long long latencyHistogram[LATENCY_BUCKETS];
+    };
+
+    // Counters for all operations at snapshot time
+    struct Snapshot {
+        OperationSnapshot operations[OP_COUNT];
+        unsigned long long peakWorkingBytes;
+    };
+
+    // Turn recording on or off at runtime
+    static void setEnabled(bool on);
+
+    // Check whether recording is on
+    static bool isEnabled() {
+#ifdef BIGNUMBER_NO_METRICS
+        return false;
+#else
+        return enabled.load(std::memory_order_relaxed);
+#endif
+    }
+
+    // Record one completed operation
+    static void record(CalcOperation op, std::size_t operandDigits, unsigned long long nanos,
+                       std::size_t bytesAllocated);
+
+    // Track working memory entering and leaving use (updates the peak)
+    static void acquireWorkingBytes(std::size_t bytes);
+    static void releaseWorkingBytes(std::size_t bytes);
+
+    // Zero every counter
+    static void reset();
+
+    // Copy the current counters
+    static Snapshot snapshot();
+
+    // Export the current counters as a JSON document
+    static std::string toJson();
+
+    // Export the current counters in Prometheus text exposition format
+    static std::string toPrometheus();
+
+    // Short lowercase name of an operation ("add", "sqrt", ...)
+    static const char* operationName(CalcOperation op);
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+/*
+CLASS: ScopedOperationTimer
+PURPOSE: RAII helper that times an instrumented operation and records it on destruction
+OPERATIONS: Construction starts the clock, addBytes charges working memory, destruction records
+LIMITATIONS: Does nothing (beyond one flag check) while PerformanceCounters is disabled
+DATE: 2026-10-19
+*/
+class ScopedOperationTimer {
+public:
+    ScopedOperationTimer(CalcOperation op, std::size_t operandDigits)
+        : op(op), operandDigits(operandDigits), bytes(0), active(PerformanceCounters::isEnabled()) {
+        if (active) {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ScopedOperationTimer(const ScopedOperationTimer&) = delete;
+    ScopedOperationTimer& operator=(const ScopedOperationTimer&) = delete;
+
+    // Charge a working buffer to this operation
+    void addBytes(std::size_t count) {
+        if (active) {
+            bytes += count;
+            PerformanceCounters::acquireWorkingBytes(count);
+        }
+    }
+
+    ~ScopedOperationTimer() {
+        if (active) {
+            unsigned long long nanos = static_cast<unsigned long long>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count());
+            PerformanceCounters::releaseWorkingBytes(bytes);
+            PerformanceCounters::record(op, operandDigits, nanos, bytes);
+        }
+    }
+
+private:
+    CalcOperation op;
+    std::size_t operandDigits;
+    std::size_t bytes;
+    bool active;
+    std::chrono::steady_clock::time_point start;
+};
+
+#endif // PERFORMANCE_COUNTERS_H
@@ -0,0 +1,170 @@
+#include "ResourceGovernor.h"
+#include "BigNumber.h"
+#include "CalculationContext.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <sstream>
+
+static std::mutex defaultLimitsMutex;
+static ResourceLimits defaultLimits;
+
+// ln(10), for converting natural-log magnitudes to decimal digits
+static const double LN10 = 2.302585092994046;
+
+void ResourceGovernor::setDefaultLimits(const ResourceLimits& limits) {
+    std::lock_guard<std::mutex> lock(defaultLimitsMutex);
+    defaultLimits = limits;
+}
+
+ResourceLimits ResourceGovernor::getDefaultLimits() {
+    std::lock_guard<std::mutex> lock(defaultLimitsMutex);
+    return defaultLimits;
+}
+
+ResourceLimits ResourceGovernor::activeLimits() {
+    ResourceLimits limits;
+    if (CalculationContext::currentLimits(limits)) {
+        return limits;
+    }
+    return getDefaultLimits();
+}
+
+// Build the exception message for an exceeded limit
+static std::string limitMessage(const char* what, double requested, double limit) {
+    std::ostringstream message;
+    message.precision(15);
+    message << what << " limit exceeded (estimated " << requested << ", limit " << limit << ")";
+    return message.str();
+}
+
+void ResourceGovernor::checkOperandLength(std::size_t length) {
+    ResourceLimits limits = activeLimits();
+    if (limits.maxOperandDigits != 0 && length > limits.maxOperandDigits) {
+        throw ResourceLimitExceeded(ResourceLimitExceeded::OPERAND_DIGITS, static_cast<double>(length),
+                                    static_cast<double>(limits.maxOperandDigits),
+                                    limitMessage("Operand digits", static_cast<double>(length),
+                                                 static_cast<double>(limits.maxOperandDigits)));
+    }
+}
+
+void ResourceGovernor::admit(double resultDigits, double memoryBytes) {
+    ResourceLimits limits = activeLimits();
+    if (limits.maxResultDigits != 0 && resultDigits > static_cast<double>(limits.maxResultDigits)) {
+        throw ResourceLimitExceeded(ResourceLimitExceeded::RESULT_DIGITS, resultDigits,
+                                    static_cast<double>(limits.maxResultDigits),
+                                    limitMessage("Result digits", resultDigits,
+                                                 static_cast<double>(limits.maxResultDigits)));
+    }
+    if (limits.maxMemoryBytes != 0 && memoryBytes > static_cast<double>(limits.maxMemoryBytes)) {
+        throw ResourceLimitExceeded(ResourceLimitExceeded::MEMORY, memoryBytes,
+                                    static_cast<double>(limits.maxMemoryBytes),
+                                    limitMessage("Memory", memoryBytes, static_cast<double>(limits.maxMemoryBytes)));
+    }
+}
+
+// toString writes the significand plus exponent zeros, or "0." and leading zeros below one
+double ResourceGovernor::printedDigits(double significandDigits, double exponent) {
+    if (exponent >= 0) {
+        return significandDigits + exponent;
+    }
+    return std::max(significandDigits, -exponent) + 1;
+}
+
+// Addition and subtraction work on the aligned window spanning both operands
+void ResourceGovernor::admitAdd(const BigNumber& a, const BigNumber& b) {
+    double low = std::min<double>(a.exponent, b.exponent);
+    double high = std::max<double>(a.exponent + static_cast<double>(a.digits.length()),
+                                   b.exponent + static_cast<double>(b.digits.length())) + 1;
+    double window = high - low;
+    admit(printedDigits(window, low), 3 * window);
+}
+
+// The product has at most la + lb digits; the digit loop keeps an int per digit
+void ResourceGovernor::admitMultiply(const BigNumber& a, const BigNumber& b) {
+    double length = static_cast<double>(a.digits.length()) + static_cast<double>(b.digits.length());
+    admit(printedDigits(length, static_cast<double>(a.exponent) + b.exponent), 6 * length);
+}
+
+// Long division scales the dividend so the quotient ends at its last kept digit and keeps ten
+// multiples of the divisor
+void ResourceGovernor::admitDivide(const BigNumber& a, const BigNumber& b) {
+    if (a.isZero() || b.isZero()) {
+        return;
+    }
+    double lb = static_cast<double>(b.digits.length());
+    long long lead = BigNumber::quotientLead(a, b);
+    long long last = BigNumber::lastKeptPosition(lead);
+    double padded = std::max(0.0, static_cast<double>(a.digits.length()) + a.exponent - b.exponent - last);
+    admit(printedDigits(static_cast<double>(lead - last + 1), static_cast<double>(last)), 3 * padded + 11 * lb);
+}
+
+// Newton's method on the digits scaled so the root ends at its last kept digit; each iteration holds
+// a few copies of that size
+void ResourceGovernor::admitSqrt(const BigNumber& a) {
+    if (a.isZero()) {
+        return;
+    }
+    long long lead = a.sqrtLead();
+    long long last = BigNumber::lastKeptPosition(lead);
+    double scaled = std::max(0.0, static_cast<double>(a.digits.length()) + a.exponent - 2.0 * last);
+    admit(printedDigits(static_cast<double>(lead - last + 1), static_cast<double>(last)), 6 * scaled);
+}
+
+// The sum spans every operand's digit window; the column holds all limbs plus 16-byte accumulator slots
+void ResourceGovernor::admitSum(const std::vector<BigNumber>& values) {
+    double low = 0;
+    double high = 0;
+    double digits = 0;
+    bool any = false;
+    for (const BigNumber& value : values) {
+        double length = static_cast<double>(value.digits.length());
+        double top = value.exponent + length;
+        low = any ? std::min<double>(low, value.exponent) : value.exponent;
+        high = any ? std::max(high, top) : top;
+        digits += length;
+        any = true;
+    }
+    if (!any) {
+        return;
+    }
+    // Carries out of a sum of n values add at most log10(n) + 1 digits
+    double window = high - low + std::log10(static_cast<double>(values.size())) + 1;
+    admit(printedDigits(window, low), digits + 2 * window);
+}
+
+// log10(n!) from lgamma; limbs, product tree and string together take a few bytes per digit
+void ResourceGovernor::admitFactorial(unsigned long n) {
+    double digits = std::lgamma(static_cast<double>(n) + 1) / LN10 + 1;
+    admit(digits, 4 * digits + static_cast<double>(n));
+}
+
+void ResourceGovernor::admitBinomial(unsigned long n, unsigned long k) {
+    double digits = 1;
+    if (k <= n) {
+        digits += (std::lgamma(static_cast<double>(n) + 1) - std::lgamma(static_cast<double>(k) + 1) -
+                   std::lgamma(static_cast<double>(n - k) + 1)) / LN10;
+    }
+    admit(digits, 4 * digits + static_cast<double>(n));
+}
+
+// The product of the primes up to n is about e^n (Chebyshev's theta function)
+void ResourceGovernor::admitPrimorial(unsigned long n) {
+    double digits = static_cast<double>(n) / LN10 + 1;
+    admit(digits, 4 * digits + static_cast<double>(n));
+}
+
+// The quotient has about la - lb + ea - eb + 1 digits before the point
+void ResourceGovernor::admitDivideStream(const BigNumber& a, const BigNumber& b, std::size_t fractionDigits) {
+    double integerDigits = std::max(1.0, static_cast<double>(a.digits.length()) + a.exponent -
+                                             (static_cast<double>(b.digits.length()) + b.exponent) + 2);
+    admit(integerDigits + static_cast<double>(fractionDigits) + 1,
+          2 * (static_cast<double>(a.digits.length()) + 11 * static_cast<double>(b.digits.length())));
+}
+
+// The root has about half as many digits before the point as the radicand
+void ResourceGovernor::admitSqrtStream(const BigNumber& a, std::size_t fractionDigits) {
+    double integerDigits = std::max(1.0, (static_cast<double>(a.digits.length()) + a.exponent) / 2 + 1);
+    double rootDigits = integerDigits + static_cast<double>(fractionDigits);
+    admit(rootDigits + 1, static_cast<double>(a.digits.length()) + 4 * rootDigits);
+}
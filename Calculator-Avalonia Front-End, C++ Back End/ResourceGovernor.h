@@ -0,0 +1,110 @@
+#ifndef RESOURCE_GOVERNOR_H
+#define RESOURCE_GOVERNOR_H
+
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class BigNumber;
+
+/*
+STRUCT: ResourceLimits
+PURPOSE: Upper bounds applied to one calculator call; zero disables a limit
+DATE: 2026-10-19
+*/
+struct ResourceLimits {
+    std::size_t maxOperandDigits;       // Characters in each input string
+    std::size_t maxResultDigits;        // Characters in the printed result
+    std::size_t maxMemoryBytes;         // Estimated peak working memory
+    std::chrono::milliseconds maxWallTime;  // Run time of the call
+
+    // Defaults: 10 million operand digits, 50 million result digits, 1 GB, 60 seconds
+    ResourceLimits()
+        : maxOperandDigits(10000000), maxResultDigits(50000000), maxMemoryBytes(1024u * 1024u * 1024u),
+          maxWallTime(60000) {}
+
+    // No limits at all
+    static ResourceLimits unlimited() {
+        ResourceLimits limits;
+        limits.maxOperandDigits = 0;
+        limits.maxResultDigits = 0;
+        limits.maxMemoryBytes = 0;
+        limits.maxWallTime = std::chrono::milliseconds(0);
+        return limits;
+    }
+};
+
+/*
+CLASS: ResourceLimitExceeded
+PURPOSE: Exception for a call rejected before it starts (operand size, estimated result size or memory)
+         or stopped because it ran past its wall-time limit
+DATE: 2026-10-19
+*/
+class ResourceLimitExceeded : public std::runtime_error {
+public:
+    enum Resource { OPERAND_DIGITS, RESULT_DIGITS, MEMORY, WALL_TIME };
+
+    ResourceLimitExceeded(Resource resource, double requested, double limit, const std::string& message)
+        : std::runtime_error(message), resource(resource), requested(requested), limit(limit) {}
+
+    // Which limit was exceeded
+    Resource getResource() const { return resource; }
+
+    // Estimated (or measured, for WALL_TIME in milliseconds) amount and the limit it exceeded
+    double getRequested() const { return requested; }
+    double getLimit() const { return limit; }
+
+private:
+    Resource resource;
+    double requested;
+    double limit;
+};
+
+/*
+CLASS: ResourceGovernor
+PURPOSE: Estimates the result size and working memory of a calculation from its operands and rejects
+         it with ResourceLimitExceeded before any heavy work starts, so a single oversized request
+         cannot take over the process
+OPERATIONS: Process-wide default limits; per-call limits come from the innermost CalculationContext
+            whose CalculationOptions carry limits. Admission checks for each operation.
+LIMITATIONS: Estimates are upper bounds from digit counts and exponents, not measurements. The wall-time
+             limit is enforced at the CalculationContext checkpoints in the inner loops.
+DATE: 2026-10-19
+*/
+class ResourceGovernor {
+public:
+    // Limits used when no CalculationContext carries its own
+    static void setDefaultLimits(const ResourceLimits& limits);
+    static ResourceLimits getDefaultLimits();
+
+    // Limits for the current call on this thread
+    static ResourceLimits activeLimits();
+
+    // Reject an input string longer than maxOperandDigits
+    static void checkOperandLength(std::size_t length);
+
+    // Admission checks; each throws ResourceLimitExceeded when an estimate is over a limit
+    static void admitAdd(const BigNumber& a, const BigNumber& b);
+    static void admitMultiply(const BigNumber& a, const BigNumber& b);
+    static void admitDivide(const BigNumber& a, const BigNumber& b);
+    static void admitSqrt(const BigNumber& a);
+    static void admitSum(const std::vector<BigNumber>& values);
+    static void admitFactorial(unsigned long n);
+    static void admitBinomial(unsigned long n, unsigned long k);
+    static void admitPrimorial(unsigned long n);
+
+    // Streaming output of fractionDigits digits after the point
+    static void admitDivideStream(const BigNumber& a, const BigNumber& b, std::size_t fractionDigits);
+    static void admitSqrtStream(const BigNumber& a, std::size_t fractionDigits);
+
+private:
+    // Check an estimated printed length and working memory against the active limits
+    static void admit(double resultDigits, double memoryBytes);
+
+    // Printed length of a value with significandDigits digits and the given exponent
+    static double printedDigits(double significandDigits, double exponent);
+};
+
+#endif // RESOURCE_GOVERNOR_H
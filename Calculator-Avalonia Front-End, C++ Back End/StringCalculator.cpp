@@ -7,7 +7,15 @@
 #include <cstring>
 #include <cmath>
 #include "StringCalculator.h"
+#include "BallNumber.h"
 #include "BigNumber.h"
+#include "BigNumberColumn.h"
+#include "CalculationCache.h"
+#include "CalculationContext.h"
+#include "DigitStream.h"
+#include "DivisorContext.h"
+#include "PerformanceCounters.h"
+#include "ResourceGovernor.h"
 
 // Validates if a character is allowed in numeric strings
 bool isValidNumericChar(char c) {
@@ -49,6 +57,10 @@ void validateNumericString(const char* str, const std::string& errorMsg) {
 
 // Processes and normalizes a string for use in the BigNumber
 std::string preprocessNumericString(const std::string& input) {
+    ScopedOperationTimer timer(OP_PREPROCESS, input.length());
+    ResourceGovernor::checkOperandLength(input.length());
+    timer.addBytes(2 * (input.length() + 1));
+    
     // Manual allocation for string buffers
     char* cleanStr = new char[input.length() + 1];
     
@@ -88,8 +100,50 @@ std::string preprocessNumericString(const std::string& input) {
     }
 }
 
-std::string addNumericStrings(const std::string& num1, const std::string& num2) {
+// Returns the process-wide result cache shared by the calculator functions
+CalculationCache& getCalculationCache() {
+    static CalculationCache cache;
+    return cache;
+}
+
+// Options carrying the active resource limits, so each call's wall-time limit starts when it is installed
+static CalculationOptions governedOptions() {
+    CalculationOptions options;
+    options.setLimits(ResourceGovernor::activeLimits());
+    return options;
+}
+
+// Runs body under the active resource limits. Cancellation, deadlines, rejections and wall-time
+// overruns pass through unchanged; any other error becomes invalid_argument prefixed with errorPrefix
+template <typename Body>
+static auto governedCall(const char* errorPrefix, Body body) -> decltype(body()) {
     try {
+        CalculationContext governed(governedOptions());
+        return body();
+    } catch (const CalculationCancelled&) {
+        throw;
+    } catch (const ResourceLimitExceeded&) {
+        throw;
+    } catch (const std::exception& e) {
+        throw std::invalid_argument(std::string(errorPrefix) + e.what());
+    }
+}
+
+// Returns the cached result for key, or computes, caches and returns it. Callers admit the operation
+// first, so a cached result is only reused while the active limits would still allow computing it
+template <typename Compute>
+static std::string cachedResult(const std::string& key, Compute compute) {
+    std::string cached;
+    if (getCalculationCache().lookup(key, cached)) {
+        return cached;
+    }
+    std::string resultStr = compute();
+    getCalculationCache().store(key, resultStr);
+    return resultStr;
+}
+
+std::string addNumericStrings(const std::string& num1, const std::string& num2) {
+    return governedCall("Error parsing numeric strings: ", [&]() {
         // Process input strings
         std::string cleanNum1 = preprocessNumericString(num1);
         std::string cleanNum2 = preprocessNumericString(num2);
@@ -97,21 +151,19 @@ std::string addNumericStrings(const std::string& num1, const std::string& num2)
         // Create BigNumber objects
         BigNumber bn1(cleanNum1);
         BigNumber bn2(cleanNum2);
+        ResourceGovernor::admitAdd(bn1, bn2);
         
-        // Perform addition
-        BigNumber result = bn1 + bn2;
-        
-        return result.toString();
-        
-    } catch (const std::exception& e) {
-        throw std::invalid_argument(std::string("Error parsing numeric strings: ") + e.what());
-    }
+        // Perform addition, reusing a previous result for the same operands
+        return cachedResult(CalculationCache::makeKey('+', cleanNum1, cleanNum2), [&]() {
+            return (bn1 + bn2).toString();
+        });
+    });
 }
 
 // Additional functions to demonstrate BigNumber capabilities
 
 std::string multiplyNumericStrings(const std::string& num1, const std::string& num2) {
-    try {
+    return governedCall("Error in multiplication: ", [&]() {
         // Process input strings
         std::string cleanNum1 = preprocessNumericString(num1);
         std::string cleanNum2 = preprocessNumericString(num2);
@@ -119,19 +171,17 @@ std::string multiplyNumericStrings(const std::string& num1, const std::string& n
         // Create BigNumber objects
         BigNumber bn1(cleanNum1);
         BigNumber bn2(cleanNum2);
+        ResourceGovernor::admitMultiply(bn1, bn2);
         
-        // Perform multiplication
-        BigNumber result = bn1 * bn2;
-        
-        return result.toString();
-        
-    } catch (const std::exception& e) {
-        throw std::invalid_argument(std::string("Error in multiplication: ") + e.what());
-    }
+        // Perform multiplication, reusing a previous result for the same operands
+        return cachedResult(CalculationCache::makeKey('*', cleanNum1, cleanNum2), [&]() {
+            return (bn1 * bn2).toString();
+        });
+    });
 }
 
 std::string divideNumericStrings(const std::string& num1, const std::string& num2) {
-    try {
+    return governedCall("Error in division: ", [&]() {
         // Process input strings
         std::string cleanNum1 = preprocessNumericString(num1);
         std::string cleanNum2 = preprocessNumericString(num2);
@@ -144,19 +194,17 @@ std::string divideNumericStrings(const std::string& num1, const std::string& num
         if (bn2.isZero()) {
             throw std::invalid_argument("Division by zero");
         }
+        ResourceGovernor::admitDivide(bn1, bn2);
         
-        // Perform division
-        BigNumber result = bn1 / bn2;
-        
-        return result.toString();
-        
-    } catch (const std::exception& e) {
-        throw std::invalid_argument(std::string("Error in division: ") + e.what());
-    }
+        // Perform division, reusing a previous result for the same operands
+        return cachedResult(CalculationCache::makeKey('/', cleanNum1, cleanNum2), [&]() {
+            return (bn1 / bn2).toString();
+        });
+    });
 }
 
 std::string sqrtNumericString(const std::string& num) {
-    try {
+    return governedCall("Error calculating square root: ", [&]() {
         // Process input string
         std::string cleanNum = preprocessNumericString(num);
         
@@ -167,13 +215,182 @@ std::string sqrtNumericString(const std::string& num) {
         if (bn.isNeg()) {
             throw std::invalid_argument("Cannot compute square root of negative number");
         }
+        ResourceGovernor::admitSqrt(bn);
         
-        // Calculate square root
-        BigNumber result = bn.sqrt();
+        // Calculate square root, reusing a previous result for the same operand
+        return cachedResult(CalculationCache::makeKey('r', cleanNum), [&]() {
+            return bn.sqrt().toString();
+        });
+    });
+} 
+
+// Parse a non-negative integer argument for the combinatorial functions
+static unsigned long parseCountArgument(const std::string& num) {
+    std::string value = BigNumber(preprocessNumericString(num)).toString();
+    if (value.find_first_of("-.") != std::string::npos) {
+        throw std::invalid_argument("Argument must be a non-negative integer");
+    }
+    if (value.length() > 9) {
+        throw std::invalid_argument("Argument too large");
+    }
+    return std::stoul(value);
+}
+
+std::string factorialNumericString(const std::string& num) {
+    return governedCall("Error calculating factorial: ", [&]() {
+        unsigned long n = parseCountArgument(num);
+        ResourceGovernor::admitFactorial(n);
         
-        return result.toString();
+        // Reuse a previous result for the same argument
+        return cachedResult(CalculationCache::makeKey('!', std::to_string(n)), [&]() {
+            return BigNumber::factorial(n).toString();
+        });
+    });
+}
+
+std::string binomialNumericStrings(const std::string& num1, const std::string& num2) {
+    return governedCall("Error calculating binomial coefficient: ", [&]() {
+        unsigned long n = parseCountArgument(num1);
+        unsigned long k = parseCountArgument(num2);
+        ResourceGovernor::admitBinomial(n, k);
         
-    } catch (const std::exception& e) {
-        throw std::invalid_argument(std::string("Error calculating square root: ") + e.what());
+        // Reuse a previous result for the same arguments
+        return cachedResult(CalculationCache::makeKey('C', std::to_string(n), std::to_string(k)), [&]() {
+            return BigNumber::binomial(n, k).toString();
+        });
+    });
+}
+
+std::string primorialNumericString(const std::string& num) {
+    return governedCall("Error calculating primorial: ", [&]() {
+        unsigned long n = parseCountArgument(num);
+        ResourceGovernor::admitPrimorial(n);
+        
+        // Reuse a previous result for the same argument
+        return cachedResult(CalculationCache::makeKey('#', std::to_string(n)), [&]() {
+            return BigNumber::primorial(n).toString();
+        });
+    });
+}
+
+std::string sumNumericStrings(const std::vector<std::string>& values) {
+    return governedCall("Error in summation: ", [&]() {
+        // Parse and admit every value, then load them into one column and reduce it in parallel
+        std::vector<BigNumber> parsed;
+        parsed.reserve(values.size());
+        for (const std::string& value : values) {
+            parsed.push_back(BigNumber(preprocessNumericString(value)));
+        }
+        ResourceGovernor::admitSum(parsed);
+        
+        BigNumberColumn column;
+        column.reserve(parsed.size());
+        for (const BigNumber& value : parsed) {
+            column.push_back(value);
+        }
+        
+        return column.sum().toString();
+    });
+}
+
+// Significant-digit format used for certified results
+static NumberFormat certifiedFormat(std::size_t digits) {
+    if (digits == 0) {
+        throw std::invalid_argument("At least one significant digit is required");
     }
-} 
\ No newline at end of file
+    NumberFormat format;
+    format.significantDigits = digits;
+    return format;
+}
+
+std::string certifiedDivideNumericStrings(const std::string& num1, const std::string& num2, std::size_t digits) {
+    return governedCall("Error in division: ", [&]() {
+        BigNumber bn1(preprocessNumericString(num1));
+        BigNumber bn2(preprocessNumericString(num2));
+        if (bn2.isZero()) {
+            throw std::invalid_argument("Division by zero");
+        }
+        ResourceGovernor::admitDivideStream(bn1, bn2, digits);
+        
+        // Raise the working precision only until the requested digits are settled
+        return BallNumber::evaluate([&](std::size_t precision) {
+            return BallNumber(bn1, precision) / BallNumber(bn2, precision);
+        }, certifiedFormat(digits));
+    });
+}
+
+std::string certifiedSqrtNumericString(const std::string& num, std::size_t digits) {
+    return governedCall("Error calculating square root: ", [&]() {
+        BigNumber bn(preprocessNumericString(num));
+        if (bn.isNeg()) {
+            throw std::invalid_argument("Cannot compute square root of negative number");
+        }
+        ResourceGovernor::admitSqrtStream(bn, digits);
+        
+        // Raise the working precision only until the requested digits are settled
+        return BallNumber::evaluate([&](std::size_t precision) {
+            return BallNumber(bn, precision).sqrt();
+        }, certifiedFormat(digits));
+    });
+}
+
+std::string formatNumericString(const std::string& num, const NumberFormat& format) {
+    return governedCall("Error formatting number: ", [&]() {
+        return BigNumber(preprocessNumericString(num)).toString(format);
+    });
+}
+
+std::vector<std::string> divideNumericStringsBy(const std::vector<std::string>& numerators,
+                                                const std::string& denominator) {
+    return governedCall("Error in division: ", [&]() {
+        BigNumber divisor(preprocessNumericString(denominator));
+        if (divisor.isZero()) {
+            throw std::invalid_argument("Division by zero");
+        }
+        
+        // Parse and admit every numerator before the reciprocal is computed
+        std::vector<BigNumber> parsed;
+        parsed.reserve(numerators.size());
+        for (const std::string& numerator : numerators) {
+            parsed.push_back(BigNumber(preprocessNumericString(numerator)));
+            ResourceGovernor::admitDivide(parsed.back(), divisor);
+        }
+        
+        DivisorContext context(divisor);
+        std::vector<std::string> results;
+        results.reserve(parsed.size());
+        for (const BigNumber& value : parsed) {
+            results.push_back(context.divide(value).toString());
+        }
+        return results;
+    });
+}
+
+void streamDivideNumericStrings(const std::string& num1, const std::string& num2, std::size_t fractionDigits,
+                                std::size_t chunkSize, const std::function<bool(const std::string&)>& callback) {
+    governedCall("Error in division: ", [&]() {
+        // Process input strings
+        BigNumber bn1(preprocessNumericString(num1));
+        BigNumber bn2(preprocessNumericString(num2));
+        
+        // Produce quotient digits as they are found
+        ResourceGovernor::admitDivideStream(bn1, bn2, fractionDigits);
+        QuotientDigitGenerator generator(bn1, bn2);
+        generator.setFractionDigits(fractionDigits);
+        generator.stream(chunkSize, callback);
+    });
+}
+
+void streamSqrtNumericString(const std::string& num, std::size_t fractionDigits,
+                             std::size_t chunkSize, const std::function<bool(const std::string&)>& callback) {
+    governedCall("Error calculating square root: ", [&]() {
+        // Process input string
+        BigNumber bn(preprocessNumericString(num));
+        
+        // Produce root digits as they are found
+        ResourceGovernor::admitSqrtStream(bn, fractionDigits);
+        SqrtDigitGenerator generator(bn);
+        generator.setFractionDigits(fractionDigits);
+        generator.stream(chunkSize, callback);
+    });
+}
\ No newline at end of file
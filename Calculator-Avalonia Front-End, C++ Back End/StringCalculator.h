@@ -1,7 +1,13 @@
 #ifndef STRING_CALCULATOR_H
 #define STRING_CALCULATOR_H
 
+#include <cstddef>
+#include <functional>
 #include <string>
+#include <vector>
+#include "NumberFormat.h"
+
+class CalculationCache;
 
 /*
 FUNCTION: Validates if a character is allowed in numeric strings
@@ -58,7 +64,9 @@ FUNCTION: Divides two numeric strings
 INPUT: Two std::string values representing numbers (dividend and divisor)
 OUTPUT: std::string containing the result of division
 SCALE: O(n^2) where n is the length of the dividend string
-LIMITATIONS: Limited precision for recurring decimals
+LIMITATIONS: Inexact quotients are truncated to 20 digits after the point, or to 20 significant digits
+             when the quotient is below one; the cut depends on the quotient's size, not on how the
+             operands are written
 DATE: 2023-06-11
 */
 std::string divideNumericStrings(const std::string& num1, const std::string& num2);
@@ -67,10 +75,127 @@ std::string divideNumericStrings(const std::string& num1, const std::string& num
 FUNCTION: Calculates the square root of a numeric string
 INPUT: A std::string representing a non-negative number
 OUTPUT: std::string containing the square root result
-SCALE: O(n^2 * iterations) where n is the length of the input string and iterations is the number of Newton's method iterations
-LIMITATIONS: Approximation using Newton's method, limited by the number of iterations
+SCALE: O(n^2 * iterations) where n is the number of significant digits and iterations is the number of Newton's method iterations
+LIMITATIONS: Integer Newton's method on the significant digits; like division, the root is truncated to
+             20 digits after the point, or to 20 significant digits when it is below one
 DATE: 2023-06-11
 */
 std::string sqrtNumericString(const std::string& num);
 
+/*
+FUNCTION: Calculates n! for a numeric string n
+INPUT: A std::string holding a non-negative integer below 10^9
+OUTPUT: std::string containing n!
+SCALE: O(M(n log n) log n) using a product tree over the prime factorization of n!
+LIMITATIONS: Sieves primes up to n, so memory grows linearly with n
+DATE: 2026-10-19
+*/
+std::string factorialNumericString(const std::string& num);
+
+/*
+FUNCTION: Calculates the binomial coefficient C(n, k)
+INPUT: Two std::strings holding non-negative integers n and k below 10^9
+OUTPUT: std::string containing C(n, k) ("0" when k > n)
+SCALE: O(M(size of result) log n) using prime exponents, with no division
+LIMITATIONS: Sieves primes up to n
+DATE: 2026-10-19
+*/
+std::string binomialNumericStrings(const std::string& num1, const std::string& num2);
+
+/*
+FUNCTION: Calculates the primorial n# (product of all primes up to n)
+INPUT: A std::string holding a non-negative integer below 10^9
+OUTPUT: std::string containing n#
+SCALE: O(M(n) log n) using a product tree
+LIMITATIONS: Sieves primes up to n
+DATE: 2026-10-19
+*/
+std::string primorialNumericString(const std::string& num);
+
+/*
+FUNCTION: Adds a whole list of numeric strings
+INPUT: A std::vector of numeric strings
+OUTPUT: std::string containing the sum ("0" for an empty list)
+SCALE: O(total digits), split across hardware threads for long lists
+LIMITATIONS: Bypasses the result cache; use BigNumberColumn directly to keep values loaded between reductions
+DATE: 2026-10-19
+*/
+std::string sumNumericStrings(const std::vector<std::string>& values);
+
+/*
+FUNCTION: Divides two numeric strings to a certified number of significant digits
+INPUT: Dividend, divisor and the number of significant digits wanted
+OUTPUT: std::string with exactly the requested digits, each one guaranteed (rounded half away from zero)
+SCALE: Ball arithmetic at increasing precision; stops as soon as the digits are certified
+LIMITATIONS: Throws std::invalid_argument for a zero divisor or zero digits
+DATE: 2026-10-19
+*/
+std::string certifiedDivideNumericStrings(const std::string& num1, const std::string& num2, std::size_t digits);
+
+/*
+FUNCTION: Square root of a numeric string to a certified number of significant digits
+INPUT: A non-negative numeric string and the number of significant digits wanted
+OUTPUT: std::string with exactly the requested digits, each one guaranteed (rounded half away from zero)
+SCALE: Ball arithmetic at increasing precision; stops as soon as the digits are certified
+LIMITATIONS: Throws std::invalid_argument for negative input or zero digits
+DATE: 2026-10-19
+*/
+std::string certifiedSqrtNumericString(const std::string& num, std::size_t digits);
+
+/*
+FUNCTION: Formats a numeric string for display
+INPUT: A numeric string and a NumberFormat (scientific, engineering, significant digits, grouping)
+OUTPUT: std::string, e.g. "1.2346e999999" for a million-digit value with 5 significant digits
+SCALE: O(significant digits) for scientific and engineering notation, independent of the value's length
+LIMITATIONS: Rounds half away from zero; zero is always "0"
+DATE: 2026-10-19
+*/
+std::string formatNumericString(const std::string& num, const NumberFormat& format);
+
+/*
+FUNCTION: Divides each numeric string in a list by the same denominator
+INPUT: A std::vector of numerators and the denominator string
+OUTPUT: std::vector of quotients, each the same as divideNumericStrings would return
+SCALE: One reciprocal of the denominator, then about two multiplications per numerator
+LIMITATIONS: Throws std::invalid_argument for a zero denominator; bypasses the result cache
+DATE: 2026-10-19
+*/
+std::vector<std::string> divideNumericStringsBy(const std::vector<std::string>& numerators,
+                                                const std::string& denominator);
+
+/*
+FUNCTION: Streams the digits of a division as they are computed
+INPUT: Dividend and divisor strings, the number of digits to produce after the decimal point, the
+       maximum chunk length, and a callback receiving each chunk (return false to stop early)
+OUTPUT: void (the concatenated chunks form the quotient truncated to fractionDigits places)
+SCALE: O(m) per digit for an m-digit divisor; the first chunk arrives after O(chunkSize * m) work
+LIMITATIONS: Bypasses the result cache. Truncates instead of rounding; a negative quotient that
+             truncates to zero is written with its sign and all fractionDigits zeros ("-0.00").
+DATE: 2026-10-19
+*/
+void streamDivideNumericStrings(const std::string& num1, const std::string& num2, std::size_t fractionDigits,
+                                std::size_t chunkSize, const std::function<bool(const std::string&)>& callback);
+
+/*
+FUNCTION: Streams the digits of a square root as they are computed
+INPUT: A non-negative numeric string, the number of digits to produce after the decimal point, the
+       maximum chunk length, and a callback receiving each chunk (return false to stop early)
+OUTPUT: void (the concatenated chunks form the root truncated to fractionDigits places)
+SCALE: O(k) per digit when k root digits have been produced, so O(n^2) for n digits in total
+LIMITATIONS: Bypasses the result cache. Truncates instead of rounding.
+DATE: 2026-10-19
+*/
+void streamSqrtNumericString(const std::string& num, std::size_t fractionDigits,
+                             std::size_t chunkSize, const std::function<bool(const std::string&)>& callback);
+
+/*
+FUNCTION: Returns the result cache shared by the calculator functions
+INPUT: None
+OUTPUT: Reference to the process-wide CalculationCache (resize, clear or read hit/miss statistics through it)
+SCALE: O(1)
+LIMITATIONS: Results are keyed on the preprocessed operand strings, so "1.0" and "1" are cached separately
+DATE: 2026-10-19
+*/
+CalculationCache& getCalculationCache();
+
 #endif // STRING_CALCULATOR_H
\ No newline at end of file
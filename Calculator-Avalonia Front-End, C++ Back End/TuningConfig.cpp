@@ -0,0 +1,109 @@
+#include "TuningConfig.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+const char* const TuningConfig::DEFAULT_FILE = "bignumber-tuning.cfg";
+
+// Constant-initialized from the compiled-in defaults before any dynamic initialization runs
+std::atomic<std::size_t> TuningConfig::limbMultiplyDigitsValue(30);
+std::atomic<std::size_t> TuningConfig::karatsubaLimbsValue(40);
+std::atomic<std::size_t> TuningConfig::parallelProductFactorsValue(2048);
+std::atomic<std::size_t> TuningConfig::parallelColumnValuesValue(4096);
+
+TuningParameters TuningConfig::get() {
+    TuningParameters parameters;
+    parameters.limbMultiplyDigits = limbMultiplyDigits();
+    parameters.karatsubaLimbs = karatsubaLimbs();
+    parameters.parallelProductFactors = parallelProductFactors();
+    parameters.parallelColumnValues = parallelColumnValues();
+    return parameters;
+}
+
+void TuningConfig::set(const TuningParameters& parameters) {
+    limbMultiplyDigitsValue.store(std::max<std::size_t>(parameters.limbMultiplyDigits, 1), std::memory_order_relaxed);
+    // Karatsuba needs at least two limbs to split
+    karatsubaLimbsValue.store(std::max<std::size_t>(parameters.karatsubaLimbs, 2), std::memory_order_relaxed);
+    parallelProductFactorsValue.store(std::max<std::size_t>(parameters.parallelProductFactors, 1),
+                                      std::memory_order_relaxed);
+    parallelColumnValuesValue.store(std::max<std::size_t>(parameters.parallelColumnValues, 1),
+                                    std::memory_order_relaxed);
+}
+
+std::string TuningConfig::defaultPath() {
+    const char* path = std::getenv("BIGNUMBER_TUNING_FILE");
+    return path && *path ? std::string(path) : std::string(DEFAULT_FILE);
+}
+
+bool TuningConfig::loadFile(const std::string& path, TuningParameters& parameters) {
+    std::ifstream file(path.c_str());
+    if (!file) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        // Strip comments, then split "key = value"
+        std::size_t hash = line.find('#');
+        if (hash != std::string::npos) {
+            line.erase(hash);
+        }
+        std::size_t equals = line.find('=');
+        if (equals == std::string::npos) {
+            continue;
+        }
+        std::istringstream keyStream(line.substr(0, equals));
+        std::istringstream valueStream(line.substr(equals + 1));
+        std::string key;
+        unsigned long long value = 0;
+        if (!(keyStream >> key) || !(valueStream >> value)) {
+            continue;
+        }
+
+        if (key == "limb_multiply_digits") {
+            parameters.limbMultiplyDigits = static_cast<std::size_t>(value);
+        } else if (key == "karatsuba_limbs") {
+            parameters.karatsubaLimbs = static_cast<std::size_t>(value);
+        } else if (key == "parallel_product_factors") {
+            parameters.parallelProductFactors = static_cast<std::size_t>(value);
+        } else if (key == "parallel_column_values") {
+            parameters.parallelColumnValues = static_cast<std::size_t>(value);
+        }
+    }
+    return true;
+}
+
+bool TuningConfig::saveFile(const std::string& path, const TuningParameters& parameters, const std::string& comment) {
+    std::ofstream file(path.c_str());
+    if (!file) {
+        return false;
+    }
+
+    file << "# BigNumber tuning parameters (written by bignumber-tune)\n";
+    if (!comment.empty()) {
+        std::istringstream lines(comment);
+        std::string line;
+        while (std::getline(lines, line)) {
+            file << "# " << line << "\n";
+        }
+    }
+    file << "limb_multiply_digits = " << parameters.limbMultiplyDigits << "\n";
+    file << "karatsuba_limbs = " << parameters.karatsubaLimbs << "\n";
+    file << "parallel_product_factors = " << parameters.parallelProductFactors << "\n";
+    file << "parallel_column_values = " << parameters.parallelColumnValues << "\n";
+    return static_cast<bool>(file);
+}
+
+// Load the tuning file once at program startup
+namespace {
+struct StartupLoader {
+    StartupLoader() {
+        TuningParameters parameters;
+        if (TuningConfig::loadFile(TuningConfig::defaultPath(), parameters)) {
+            TuningConfig::set(parameters);
+        }
+    }
+};
+StartupLoader startupLoader;
+} // namespace
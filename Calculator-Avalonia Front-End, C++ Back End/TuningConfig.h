@@ -0,0 +1,67 @@
+#ifndef TUNING_CONFIG_H
+#define TUNING_CONFIG_H
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+/*
+STRUCT: TuningParameters
+PURPOSE: Algorithm crossover points that depend on the host's caches and core count
+DATE: 2026-10-19
+*/
+struct TuningParameters {
+    std::size_t limbMultiplyDigits;      // Operand digits where BigNumber::operator* switches to limbs
+    std::size_t karatsubaLimbs;          // Operand limbs where limb multiplication switches to Karatsuba
+    std::size_t parallelProductFactors;  // Factors per product tree branch worth a separate thread
+    std::size_t parallelColumnValues;    // Column values per thread worth a separate thread
+
+    // Compiled-in defaults, used when no tuning file is found
+    TuningParameters()
+        : limbMultiplyDigits(30), karatsubaLimbs(40), parallelProductFactors(2048), parallelColumnValues(4096) {}
+};
+
+/*
+CLASS: TuningConfig
+PURPOSE: Holds the active TuningParameters. At startup they are read from the file named by the
+         BIGNUMBER_TUNING_FILE environment variable, or from bignumber-tuning.cfg in the working
+         directory; the compiled-in defaults apply when neither exists.
+OPERATIONS: Lock-free reads of each parameter for the hot paths, get/set of the whole set,
+            load/save of "key = value" files (written by the bignumber-tune tool)
+LIMITATIONS: Unknown keys and malformed lines in a file are ignored; zero values are raised to 1
+DATE: 2026-10-19
+*/
+class TuningConfig {
+public:
+    // Default file name looked up in the working directory
+    static const char* const DEFAULT_FILE;
+
+    // Individual parameters (relaxed atomic loads)
+    static std::size_t limbMultiplyDigits() { return limbMultiplyDigitsValue.load(std::memory_order_relaxed); }
+    static std::size_t karatsubaLimbs() { return karatsubaLimbsValue.load(std::memory_order_relaxed); }
+    static std::size_t parallelProductFactors() {
+        return parallelProductFactorsValue.load(std::memory_order_relaxed);
+    }
+    static std::size_t parallelColumnValues() { return parallelColumnValuesValue.load(std::memory_order_relaxed); }
+
+    // Read or replace the whole set
+    static TuningParameters get();
+    static void set(const TuningParameters& parameters);
+
+    // Path used at startup (environment variable or DEFAULT_FILE)
+    static std::string defaultPath();
+
+    // Read a tuning file over the given parameters; false if it could not be opened
+    static bool loadFile(const std::string& path, TuningParameters& parameters);
+
+    // Write a tuning file; false if it could not be written
+    static bool saveFile(const std::string& path, const TuningParameters& parameters, const std::string& comment = "");
+
+private:
+    static std::atomic<std::size_t> limbMultiplyDigitsValue;
+    static std::atomic<std::size_t> karatsubaLimbsValue;
+    static std::atomic<std::size_t> parallelProductFactorsValue;
+    static std::atomic<std::size_t> parallelColumnValuesValue;
+};
+
+#endif // TUNING_CONFIG_H
@@ -8,7 +8,7 @@ if not exist "obj" mkdir obj
 if not exist "bin" mkdir bin
 
 REM Set compiler flags
-set COMMON_FLAGS=-Wall -Wextra -std=c++11
+set COMMON_FLAGS=-Wall -Wextra -std=c++14 -pthread
 set DEBUG_FLAGS=-g -O0 -DDEBUG
 set RELEASE_FLAGS=-O3 -DNDEBUG
 
@@ -35,12 +35,57 @@ if %errorlevel% neq 0 goto error
 g++ %FLAGS% -c -o obj\StringCalculator.o StringCalculator.cpp
 if %errorlevel% neq 0 goto error
 
+g++ %FLAGS% -c -o obj\CalculationCache.o CalculationCache.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\PerformanceCounters.o PerformanceCounters.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\CalculationContext.o CalculationContext.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\AsyncCalculator.o AsyncCalculator.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\DigitStrings.o DigitStrings.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\DigitStream.o DigitStream.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\BigNumberColumn.o BigNumberColumn.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\LimbArithmetic.o LimbArithmetic.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\ResourceGovernor.o ResourceGovernor.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\TuningConfig.o TuningConfig.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\MappedBigNumber.o MappedBigNumber.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\DivisorContext.o DivisorContext.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\BallNumber.o BallNumber.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\CalculationGraph.o CalculationGraph.cpp
+if %errorlevel% neq 0 goto error
+
+g++ %FLAGS% -c -o obj\DoubleConversion.o DoubleConversion.cpp
+if %errorlevel% neq 0 goto error
+
 g++ %FLAGS% -c -o obj\main.o main.cpp
 if %errorlevel% neq 0 goto error
 
 REM Link object files
 echo Linking...
-g++ %FLAGS% -o %EXE_NAME% obj\main.o obj\BigNumber.o obj\StringCalculator.o
+g++ %FLAGS% -o %EXE_NAME% obj\main.o obj\BigNumber.o obj\StringCalculator.o obj\CalculationCache.o obj\PerformanceCounters.o obj\CalculationContext.o obj\AsyncCalculator.o obj\DigitStrings.o obj\DigitStream.o obj\BigNumberColumn.o obj\LimbArithmetic.o obj\ResourceGovernor.o obj\TuningConfig.o obj\MappedBigNumber.o obj\DivisorContext.o obj\BallNumber.o obj\CalculationGraph.o obj\DoubleConversion.o
 if %errorlevel% neq 0 goto error
 
 echo Build completed successfully!